@@ -1,21 +1,48 @@
+#include "src/alloc_tracker.cpp"
+#include "src/perf_counters.cpp"
+#include "src/core_scheduler.cpp"
 #include "src/graph.cpp"
+#include "src/dataset_loader.cpp"
+#include "src/bitset_graph.cpp"
+#include "src/search_stack.cpp"
+#include "src/search_stats.cpp"
+#include "src/clique_state.cpp"
 #include "src/greedy.cpp"
 #include "src/randomized_heuristic.cpp"
 #include "src/simulated_annealing.cpp"
 #include "src/ostergard.cpp"
+#include "src/clique_arena.cpp"
 #include "src/bbmc.cpp"
 #include "src/degeneracy_bk.cpp"
 #include "src/tomita.cpp"
 #include "src/bron_kerbosch.cpp"
 #include "src/cpu_optimized.cpp"
 #include "src/maxclique_dyn.cpp"
+#include "src/dynamic_local_search.cpp"
+#include "src/tabu_search.cpp"
+#include "src/solver_registry.cpp"
+#include "src/result_compare.cpp"
 
 #include <iostream>
 #include <fstream>
 #include <chrono>
 #include <iomanip>
 #include <cmath>
+#include <map>
+#include <functional>
+#include <sstream>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+#include <csignal>
+#include <new>
+#include <memory>
+#include <ctime>
+#include <mutex>
+#include <thread>
 #include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 // Memory measurement utilities
 size_t get_memory_usage_kb() {
@@ -24,176 +51,786 @@ size_t get_memory_usage_kb() {
     return usage.ru_maxrss;  // In KB on Linux, bytes on macOS
 }
 
-// Graph statistics computation
-struct GraphStats {
-    int num_vertices;
-    int num_edges;
-    double density;
-    int max_degree;
-    double avg_degree;
-    int degeneracy;
-    
-    void compute(const Graph& g) {
-        num_vertices = g.num_vertices();
-        num_edges = g.num_edges();
-        density = g.get_density();
+// Statistics over the repeated runs of one algorithm
+struct RunStatistics {
+    int runs = 0;
+    double min = 0, median = 0, mean = 0, stddev = 0;
+    double ci_low = 0, ci_high = 0;   // 95% bootstrap confidence interval of the mean
+    double mean_clique_size = 0;
+    std::map<int, int> clique_sizes;  // Clique size -> number of runs
+    
+    static RunStatistics compute(const std::vector<double>& times, const std::vector<int>& sizes) {
+        RunStatistics st;
+        st.runs = times.size();
+        if (times.empty()) return st;
+        
+        std::vector<double> sorted = times;
+        std::sort(sorted.begin(), sorted.end());
+        size_t n = sorted.size();
+        st.min = sorted.front();
+        st.median = n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+        for (double t : sorted) st.mean += t;
+        st.mean /= n;
+        if (n > 1) {
+            double sq = 0;
+            for (double t : sorted) sq += (t - st.mean) * (t - st.mean);
+            st.stddev = std::sqrt(sq / (n - 1));
+        }
         
-        // Compute max and avg degree
-        max_degree = 0;
-        long long total_degree = 0;
-        for (int v = 0; v < num_vertices; v++) {
-            int deg = g.get_degree(v);
-            max_degree = std::max(max_degree, deg);
-            total_degree += deg;
-        }
-        avg_degree = num_vertices > 0 ? (double)total_degree / num_vertices : 0.0;
+        // Percentile bootstrap with a fixed seed, so reruns report the same interval
+        st.ci_low = st.ci_high = st.mean;
+        if (n > 1) {
+            const int RESAMPLES = 2000;
+            std::mt19937 rng(12345);
+            std::uniform_int_distribution<size_t> pick(0, n - 1);
+            std::vector<double> means(RESAMPLES);
+            for (int b = 0; b < RESAMPLES; b++) {
+                double sum = 0;
+                for (size_t i = 0; i < n; i++) sum += sorted[pick(rng)];
+                means[b] = sum / n;
+            }
+            std::sort(means.begin(), means.end());
+            st.ci_low = means[(size_t)(0.025 * (RESAMPLES - 1))];
+            st.ci_high = means[(size_t)(0.975 * (RESAMPLES - 1))];
+        }
         
-        // Compute degeneracy
-        degeneracy = g.get_degeneracy();
+        for (int size : sizes) {
+            st.clique_sizes[size]++;
+            st.mean_clique_size += size;
+        }
+        st.mean_clique_size /= sizes.size();
+        return st;
+    }
+    
+    // Clique-size distribution as "size:count;size:count"
+    std::string distribution() const {
+        std::ostringstream out;
+        for (auto it = clique_sizes.begin(); it != clique_sizes.end(); ++it) {
+            if (it != clique_sizes.begin()) out << ";";
+            out << it->first << ":" << it->second;
+        }
+        return out.str();
+    }
+};
+
+// Fixed-size digest of an exact solver's SearchStats (-1 = not recorded)
+struct SearchSummary {
+    int max_depth = -1;
+    long long leaves = -1;
+    long long size_prunes = -1;
+    long long coloring_prunes = -1;
+    long long suffix_prunes = -1;
+    int incumbent_updates = -1;
+    double time_to_best = -1;  // Seconds until the final incumbent was found
+    
+    bool recorded() const { return max_depth >= 0; }
+    
+    static SearchSummary from(const SearchStats& s) {
+        SearchSummary summary;
+        summary.max_depth = s.max_depth;
+        summary.leaves = s.leaves;
+        summary.size_prunes = s.size_prunes;
+        summary.coloring_prunes = s.coloring_prunes;
+        summary.suffix_prunes = s.suffix_prunes;
+        summary.incumbent_updates = s.incumbent_updates.size();
+        summary.time_to_best = s.incumbent_updates.empty() ? 0.0 : s.incumbent_updates.back().seconds;
+        return summary;
+    }
+    
+    // Nodes per depth as "depth:count;depth:count"
+    static std::string histogram(const SearchStats& s) {
+        std::ostringstream out;
+        for (size_t d = 0; d < s.depth_histogram.size(); d++) {
+            if (d > 0) out << ";";
+            out << d << ":" << s.depth_histogram[d];
+        }
+        return out.str();
     }
 };
 
 // Benchmark result structure
 struct BenchmarkResult {
     std::string algorithm;
-    int clique_size;
-    double time_seconds;
-    size_t memory_kb;
-    bool success;
+    int clique_size = 0;
+    double time_seconds = 0.0;
+    size_t memory_kb = 0;
+    bool success = false;
+    bool timed_out = false;   // Stopped by --timeout; clique_size is the incumbent
+    long long nodes = -1;     // Search nodes explored (-1 = not reported)
+    long peak_rss_kb = -1;    // Peak RSS of the isolated child (-1 = not isolated)
+    double cpu_seconds = -1;  // User + system CPU time of the run
+    unsigned int seed = 0;    // Seed passed to the heuristics
+    int calls = 1;            // Calls averaged into time_seconds (--min-time)
+    long long alloc_bytes = -1;      // Heap bytes requested (-1 = built without TRACK_ALLOCATIONS)
+    long long allocations = -1;      // operator new calls
+    long long peak_live_bytes = -1;  // Peak heap bytes live at once
+    PerfReading perf;                // Hardware counters (-1 = unavailable)
+    SearchSummary search;            // Search-tree shape (needs SEARCH_STATS)
+    std::string depth_histogram;     // Nodes per depth, see SearchSummary::histogram
+    RunStatistics stats;      // Over all measured runs (summary rows only)
     std::string error;
+    
+    std::string status() const {
+        if (success) return "OK";
+        if (timed_out) return "TIMEOUT";
+        if (error.rfind("Skipped", 0) == 0) return "SKIPPED";
+        if (error == "Out of memory") return "OOM";
+        if (error == "CPU limit exceeded") return "CPU_LIMIT";
+        if (error.rfind("Crashed", 0) == 0) return "CRASHED";
+        return "FAILED";
+    }
 };
 
-// Helper functions for algorithms with different interfaces
-BenchmarkResult run_greedy(const Graph& g) {
-    BenchmarkResult result;
-    result.algorithm = "Greedy";
-    result.success = false;
-    size_t mem_before = get_memory_usage_kb();
-    auto start = std::chrono::high_resolution_clock::now();
-    try {
-        std::vector<int> clique = GreedyClique::find_clique(g);
-        auto end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double> elapsed = end - start;
-        size_t mem_after = get_memory_usage_kb();
-        if (g.is_clique(clique)) {
-            result.clique_size = clique.size();
-            result.time_seconds = elapsed.count();
-            result.memory_kb = mem_after - mem_before;
-            result.success = true;
+// Skip rule: run an algorithm only on graphs within these limits
+struct SkipRule {
+    int max_vertices = -1;      // -1 = no limit
+    double max_density = -1.0;  // -1 = no limit
+};
+
+// Which algorithms to skip on which graphs, keyed by algorithm name
+struct SkipPolicy {
+    std::map<std::string, SkipRule> rules;
+    
+    // Vanilla BK and CPU Optimized only run on small, sparse graphs
+    static SkipPolicy defaults() {
+        SkipPolicy policy;
+        policy.rules["Bron-Kerbosch"] = {1000, 0.5};
+        policy.rules["CPU Optimized"] = {1000, 0.5};
+        return policy;
+    }
+    
+    // Parse "NAME:MAX_VERTICES:MAX_DENSITY" and set NAME's rule
+    bool add_rule(const std::string& spec) {
+        size_t second = spec.rfind(':');
+        if (second == std::string::npos || second == 0) return false;
+        size_t first = spec.rfind(':', second - 1);
+        if (first == std::string::npos || first == 0) return false;
+        
+        SkipRule rule;
+        rule.max_vertices = std::atoi(spec.substr(first + 1, second - first - 1).c_str());
+        rule.max_density = std::atof(spec.substr(second + 1).c_str());
+        rules[spec.substr(0, first)] = rule;
+        return true;
+    }
+    
+    bool should_skip(const std::string& algorithm, const GraphStats& stats,
+                     std::string& reason) const {
+        auto it = rules.find(algorithm);
+        if (it == rules.end()) return false;
+        
+        const SkipRule& rule = it->second;
+        std::ostringstream why;
+        if (rule.max_vertices >= 0 && stats.num_vertices > rule.max_vertices) {
+            why << "vertices > " << rule.max_vertices;
+        } else if (rule.max_density >= 0 && stats.density > rule.max_density) {
+            why << "density > " << rule.max_density;
+        } else {
+            return false;
         }
-    } catch (...) { result.error = "Exception"; }
-    return result;
+        reason = why.str();
+        return true;
+    }
+};
+
+// Copy an exact solver's search-tree statistics into its result
+static void record_search(BenchmarkResult& result, const SearchStats& s) {
+    if (!SearchStatsRecorder::enabled()) return;
+    result.search = SearchSummary::from(s);
+    result.depth_histogram = SearchSummary::histogram(s);
 }
 
-BenchmarkResult run_randomized(const Graph& g) {
+/**
+ * One call of a registered solver with timing and memory tracking
+ *
+ * The run's seed and --timeout become the solver's seed and time_limit
+ * options, unless the solver does not read them or they were set for it
+ * explicitly with --algo.
+ */
+BenchmarkResult run_solver(const SolverSelection& selection, const Graph& g,
+                           double timeout, unsigned int seed) {
+    const SolverInfo& solver = *selection.solver;
     BenchmarkResult result;
-    result.algorithm = "Randomized";
+    result.algorithm = solver.name;
     result.success = false;
+    
+    SolverOptions options = selection.options;
+    if (solver.accepts("seed") && !options.has("seed")) {
+        options.set("seed", std::to_string(seed));
+    }
+    if (solver.accepts("time_limit") && !options.has("time_limit")) {
+        std::ostringstream limit;
+        limit << timeout;
+        options.set("time_limit", limit.str());
+    }
+    
     size_t mem_before = get_memory_usage_kb();
     auto start = std::chrono::high_resolution_clock::now();
+    
     try {
-        RandomizedHeuristic algo;
-        std::vector<int> clique = algo.find_clique(g);
+        SolverOutput out = solver.run(g, options);
         auto end = std::chrono::high_resolution_clock::now();
         std::chrono::duration<double> elapsed = end - start;
         size_t mem_after = get_memory_usage_kb();
-        if (g.is_clique(clique)) {
-            result.clique_size = clique.size();
+        result.nodes = out.nodes;
+        if (solver.exact) record_search(result, out.search);
+        
+        if (g.is_clique(out.clique)) {
+            result.clique_size = out.clique.size();
             result.time_seconds = elapsed.count();
             result.memory_kb = mem_after - mem_before;
-            result.success = true;
+            result.timed_out = out.timed_out;
+            result.success = !result.timed_out;
+            if (result.timed_out) result.error = "Timeout";
+        } else {
+            result.error = "Invalid clique returned";
         }
-    } catch (...) { result.error = "Exception"; }
+    } catch (const std::bad_alloc&) {
+        result.error = "Out of memory";
+    } catch (const std::exception& e) {
+        result.error = std::string("Exception: ") + e.what();
+    } catch (...) {
+        result.error = "Unknown exception";
+    }
+    
     return result;
 }
 
-BenchmarkResult run_simulated_annealing(const Graph& g) {
-    BenchmarkResult result;
-    result.algorithm = "Simulated Annealing";
-    result.success = false;
-    size_t mem_before = get_memory_usage_kb();
-    auto start = std::chrono::high_resolution_clock::now();
-    try {
-        SimulatedAnnealing algo;
-        std::vector<int> clique = algo.find_clique(g);
-        auto end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double> elapsed = end - start;
-        size_t mem_after = get_memory_usage_kb();
-        if (g.is_clique(clique)) {
-            result.clique_size = clique.size();
-            result.time_seconds = elapsed.count();
-            result.memory_kb = mem_after - mem_before;
-            result.success = true;
-        }
-    } catch (...) { result.error = "Exception"; }
-    return result;
+// Resource caps for runs in a forked child
+struct IsolationLimits {
+    bool enabled = true;
+    size_t memory_mb = 0;      // RLIMIT_AS (0 = none)
+    double cpu_seconds = 0.0;  // RLIMIT_CPU (0 = none)
+};
+
+// How often each algorithm is run
+struct RepeatConfig {
+    int repeat = 1;              // Measured runs
+    int warmup = 0;              // Discarded runs before them
+    unsigned int base_seed = 1;  // Run i uses base_seed + i (0 = random every run)
+    double min_time = 0.0;       // Adaptive: repeat calls within a run until this many seconds
+};
+
+// Concurrent, pinned jobs (jobs = 0 runs every algorithm in turn, unpinned)
+struct ScheduleConfig {
+    int jobs = 0;            // Jobs running at once
+    bool isolated = false;   // Leave hyperthread siblings of job CPUs idle
+    int job_cores = 1;       // CPUs claimed by each job of a multi-threaded solver
+    std::vector<int> cpus;   // CPUs jobs are placed on, filled in by main
+};
+
+struct BenchmarkOptions {
+    double timeout = 0.0;
+    bool perf = true;  // Read hardware counters around each run
+    SkipPolicy skip = SkipPolicy::defaults();
+    IsolationLimits isolation;
+    RepeatConfig repeat;
+    ScheduleConfig schedule;
+    std::vector<SolverSelection> solvers;  // Empty = every solver that runs by default
+};
+
+// Fixed-size part of a result sent from the child; error text follows
+struct WireResult {
+    int clique_size;
+    double time_seconds;
+    size_t memory_kb;
+    bool success;
+    bool timed_out;
+    long long nodes;
+    double cpu_seconds;
+    unsigned int seed;
+    int calls;
+    long long alloc_bytes;
+    long long allocations;
+    long long peak_live_bytes;
+    PerfReading perf;
+    SearchSummary search;
+    size_t error_length;
+    size_t histogram_length;
+};
+
+static bool write_all(int fd, const void* data, size_t length) {
+    const char* p = static_cast<const char*>(data);
+    while (length > 0) {
+        ssize_t n = write(fd, p, length);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        length -= n;
+    }
+    return true;
 }
 
-BenchmarkResult run_bbmc(const Graph& g) {
-    BenchmarkResult result;
-    result.algorithm = "BBMC";
-    result.success = false;
-    size_t mem_before = get_memory_usage_kb();
-    auto start = std::chrono::high_resolution_clock::now();
-    try {
-        BBMC algo(g, BBMC::DEGREE_ORDER);
-        std::vector<int> clique = algo.find_maximum_clique();
-        auto end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double> elapsed = end - start;
-        size_t mem_after = get_memory_usage_kb();
-        if (g.is_clique(clique)) {
-            result.clique_size = clique.size();
-            result.time_seconds = elapsed.count();
-            result.memory_kb = mem_after - mem_before;
-            result.success = true;
-        }
-    } catch (...) { result.error = "Exception"; }
-    return result;
+static bool read_all(int fd, void* data, size_t length) {
+    char* p = static_cast<char*>(data);
+    while (length > 0) {
+        ssize_t n = read(fd, p, length);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        length -= n;
+    }
+    return true;
 }
 
-// Run single algorithm with timeout and memory tracking
-template<typename AlgoClass>
-BenchmarkResult run_algorithm(const Graph& g, const std::string& algo_name) {
-    BenchmarkResult result;
-    result.algorithm = algo_name;
-    result.success = false;
+// User + system CPU time of this process, all threads included
+static double process_cpu_seconds() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+           usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+}
+
+/**
+ * Run one algorithm's series of runs in a forked child so a crash, OOM
+ * or fragmented heap cannot affect the algorithms after it
+ *
+ * The child applies the address-space and CPU caps, calls run(0..count-1)
+ * and streams each result to a pipe as soon as it is done. The parent
+ * reads results until the pipe closes and reaps the child with wait4,
+ * whose rusage gives the child's own peak RSS. If the child dies early,
+ * the results it sent are kept and a failed result naming the signal or
+ * exit status is appended.
+ *
+ * With cpus given, the child is pinned to them before it runs anything.
+ * Callers may run several of these at once from different threads.
+ */
+std::vector<BenchmarkResult> run_isolated(const std::string& name, const IsolationLimits& limits,
+                                          int count, const std::function<BenchmarkResult(int)>& run,
+                                          const std::vector<int>& cpus = {}) {
+    std::vector<BenchmarkResult> results;
+    BenchmarkResult failure;
+    failure.algorithm = name;
     
-    size_t mem_before = get_memory_usage_kb();
-    auto start = std::chrono::high_resolution_clock::now();
+    // The write end must be closed here before another thread forks,
+    // or that child would hold it open and hide this child's exit
+    static std::mutex fork_mutex;
+    std::unique_lock<std::mutex> fork_lock(fork_mutex);
+    int fds[2];
+    if (pipe(fds) != 0) {
+        failure.error = std::string("pipe failed: ") + std::strerror(errno);
+        results.push_back(failure);
+        return results;
+    }
     
-    try {
-        AlgoClass algo;
-        std::vector<int> clique = algo.find_maximum_clique(g);
-        auto end = std::chrono::high_resolution_clock::now();
-        std::chrono::duration<double> elapsed = end - start;
-        size_t mem_after = get_memory_usage_kb();
+    std::cout.flush();
+    std::cerr.flush();
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        failure.error = std::string("fork failed: ") + std::strerror(errno);
+        results.push_back(failure);
+        return results;
+    }
+    
+    if (pid == 0) {
+        close(fds[0]);
+        if (!cpus.empty() && !pin_to_cpus(cpus)) {
+            _exit(2);
+        }
+        if (limits.memory_mb > 0) {
+            struct rlimit rl;
+            rl.rlim_cur = rl.rlim_max = (rlim_t)limits.memory_mb * 1024 * 1024;
+            setrlimit(RLIMIT_AS, &rl);
+        }
+        if (limits.cpu_seconds > 0) {
+            // SIGXCPU at the soft limit, SIGKILL one second later
+            struct rlimit rl;
+            rl.rlim_cur = (rlim_t)std::ceil(limits.cpu_seconds);
+            rl.rlim_max = rl.rlim_cur + 1;
+            setrlimit(RLIMIT_CPU, &rl);
+        }
         
-        if (g.is_clique(clique)) {
-            result.clique_size = clique.size();
-            result.time_seconds = elapsed.count();
-            result.memory_kb = mem_after - mem_before;
-            result.success = true;
+        for (int i = 0; i < count; i++) {
+            BenchmarkResult r = run(i);
+            WireResult wire = {r.clique_size, r.time_seconds, r.memory_kb, r.success,
+                               r.timed_out, r.nodes, r.cpu_seconds, r.seed, r.calls,
+                               r.alloc_bytes, r.allocations, r.peak_live_bytes, r.perf,
+                               r.search, r.error.size(), r.depth_histogram.size()};
+            if (!write_all(fds[1], &wire, sizeof(wire)) ||
+                !write_all(fds[1], r.error.data(), r.error.size()) ||
+                !write_all(fds[1], r.depth_histogram.data(), r.depth_histogram.size())) {
+                _exit(1);
+            }
+        }
+        close(fds[1]);
+        _exit(0);  // Skip atexit handlers and stdio buffers shared with the parent
+    }
+    
+    close(fds[1]);
+    fork_lock.unlock();
+    WireResult wire;
+    while ((int)results.size() < count && read_all(fds[0], &wire, sizeof(wire))) {
+        BenchmarkResult r;
+        r.algorithm = name;
+        r.error.resize(wire.error_length);
+        r.depth_histogram.resize(wire.histogram_length);
+        if (!read_all(fds[0], &r.error[0], wire.error_length) ||
+            !read_all(fds[0], &r.depth_histogram[0], wire.histogram_length)) break;
+        r.clique_size = wire.clique_size;
+        r.time_seconds = wire.time_seconds;
+        r.memory_kb = wire.memory_kb;
+        r.success = wire.success;
+        r.timed_out = wire.timed_out;
+        r.nodes = wire.nodes;
+        r.cpu_seconds = wire.cpu_seconds;
+        r.seed = wire.seed;
+        r.calls = wire.calls;
+        r.alloc_bytes = wire.alloc_bytes;
+        r.allocations = wire.allocations;
+        r.peak_live_bytes = wire.peak_live_bytes;
+        r.perf = wire.perf;
+        r.search = wire.search;
+        results.push_back(r);
+    }
+    close(fds[0]);
+    
+    int status = 0;
+    struct rusage usage;
+    while (wait4(pid, &status, 0, &usage) < 0 && errno == EINTR) {}
+    for (auto& r : results) {
+        r.peak_rss_kb = usage.ru_maxrss;
+    }
+    
+    if ((int)results.size() == count && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        return results;
+    }
+    if (WIFSIGNALED(status)) {
+        int sig = WTERMSIG(status);
+        if (limits.cpu_seconds > 0 && (sig == SIGXCPU || sig == SIGKILL)) {
+            failure.error = "CPU limit exceeded";
         } else {
-            result.error = "Invalid clique returned";
+            failure.error = "Crashed (signal " + std::to_string(sig) + ": " + strsignal(sig) + ")";
         }
-    } catch (const std::exception& e) {
-        result.error = std::string("Exception: ") + e.what();
-    } catch (...) {
-        result.error = "Unknown exception";
+    } else if (WIFEXITED(status) && WEXITSTATUS(status) == 2 && !cpus.empty() && results.empty()) {
+        failure.error = "Could not pin to CPUs";
+    } else {
+        failure.error = "Child exited with status " +
+                        std::to_string(WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+    }
+    failure.peak_rss_kb = usage.ru_maxrss;
+    failure.cpu_seconds = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6 +
+                          usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+    results.push_back(failure);
+    return results;
+}
+
+/**
+ * One run of an algorithm with the given seed, timing its CPU use too
+ *
+ * With min_time > 0 the algorithm is called again until the calls add up
+ * to min_time seconds, and the run reports the mean time per call. This
+ * gives microsecond-scale algorithms like Greedy a measurable time.
+ * Heap usage and hardware counters are likewise reported per call.
+ */
+BenchmarkResult run_once(const std::string& name,
+                         const std::function<BenchmarkResult(unsigned int)>& run,
+                         unsigned int seed, double min_time, bool count_events) {
+    std::unique_ptr<PerfCounters> counters;
+    if (count_events) {
+        counters.reset(new PerfCounters());
+    }
+    AllocationScope scope(name);
+    if (counters) counters->start();
+    double cpu_before = process_cpu_seconds();
+    BenchmarkResult result = run(seed);
+    
+    double total = result.time_seconds;
+    while (min_time > 0 && result.success && total < min_time) {
+        BenchmarkResult again = run(seed);
+        if (!again.success) break;
+        total += again.time_seconds;
+        result.calls++;
     }
     
+    if (counters) {
+        result.perf = counters->stop();
+        for (long long& v : result.perf.values) {
+            if (v >= 0) v /= result.calls;
+        }
+    }
+    result.time_seconds = total / result.calls;
+    result.cpu_seconds = (process_cpu_seconds() - cpu_before) / result.calls;
+    result.seed = seed;
+    if (AllocationTracker::enabled()) {
+        AllocationStats heap = scope.stats();
+        result.alloc_bytes = heap.bytes / result.calls;
+        result.allocations = heap.allocations / result.calls;
+        result.peak_live_bytes = heap.peak_live_bytes;
+    }
     return result;
 }
 
-int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " <graph_file>" << std::endl;
-        return 1;
+/**
+ * Combine the measured runs of one algorithm into the row reported for it
+ *
+ * A failed run makes the whole row fail. Otherwise the row holds the
+ * largest clique found, the median time, the mean CPU time, heap counts
+ * and hardware counters, and the highest heap peak, and is a TIMEOUT if
+ * any run timed out. stats always covers the runs that finished
+ * or timed out.
+ */
+BenchmarkResult summarize_runs(const std::string& name, const std::vector<BenchmarkResult>& runs) {
+    std::vector<double> times;
+    std::vector<int> sizes;
+    const BenchmarkResult* failed = nullptr;
+    BenchmarkResult summary = runs.front();
+    summary.algorithm = name;
+    summary.clique_size = 0;
+    summary.cpu_seconds = 0;
+    if (AllocationTracker::enabled()) {
+        summary.alloc_bytes = summary.allocations = 0;
     }
     
-    std::string filename = argv[1];
-    std::string dataset_name = filename.substr(filename.find_last_of("/\\") + 1);
+    for (const auto& r : runs) {
+        summary.memory_kb = std::max(summary.memory_kb, r.memory_kb);
+        summary.peak_rss_kb = std::max(summary.peak_rss_kb, r.peak_rss_kb);
+        if (!r.success && !r.timed_out) {
+            failed = &r;
+            continue;
+        }
+        times.push_back(r.time_seconds);
+        sizes.push_back(r.clique_size);
+        summary.clique_size = std::max(summary.clique_size, r.clique_size);
+        summary.cpu_seconds += r.cpu_seconds;
+        if (AllocationTracker::enabled()) {
+            summary.alloc_bytes += r.alloc_bytes;
+            summary.allocations += r.allocations;
+            summary.peak_live_bytes = std::max(summary.peak_live_bytes, r.peak_live_bytes);
+        }
+        summary.timed_out = summary.timed_out || r.timed_out;
+    }
+    
+    // Mean of each counter over the runs that have it
+    for (int e = 0; e < PerfReading::NUM_EVENTS; e++) {
+        long long sum = 0;
+        int count = 0;
+        for (const auto& r : runs) {
+            if ((r.success || r.timed_out) && r.perf.values[e] >= 0) {
+                sum += r.perf.values[e];
+                count++;
+            }
+        }
+        summary.perf.values[e] = count > 0 ? sum / count : -1;
+    }
+    
+    if (!times.empty()) {
+        summary.stats = RunStatistics::compute(times, sizes);
+        summary.time_seconds = summary.stats.median;
+        summary.cpu_seconds /= times.size();
+        if (AllocationTracker::enabled()) {
+            summary.alloc_bytes /= (long long)times.size();
+            summary.allocations /= (long long)times.size();
+        }
+    }
+    if (failed) {
+        summary.success = false;
+        summary.timed_out = false;
+        summary.error = failed->error;
+    } else {
+        summary.success = !summary.timed_out;
+        summary.error = summary.timed_out ? "Timeout" : "";
+    }
+    return summary;
+}
+
+// Seed of measured run i; warmups repeat the seed of the run they precede
+static unsigned int run_seed(const RepeatConfig& repeat, int measured) {
+    return repeat.base_seed == 0 ? 0 : repeat.base_seed + measured;
+}
+
+// The row for an algorithm the skip policy excludes on this graph, if it does
+static bool skip_result(const std::string& name, const GraphStats& stats,
+                        const BenchmarkOptions& options, BenchmarkResult& skipped) {
+    std::string reason;
+    if (!options.skip.should_skip(name, stats, reason)) return false;
+    skipped = BenchmarkResult();
+    skipped.algorithm = name;
+    skipped.error = "Skipped: " + reason;
+    return true;
+}
+
+// Progress line ending for a finished or skipped algorithm
+static void print_outcome(const BenchmarkResult& r) {
+    if (r.success) {
+        std::cout << "✓ Size: " << std::setw(3) << r.clique_size 
+                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r.time_seconds << " s";
+        if (r.stats.runs > 1) {
+            std::cout << " (median of " << r.stats.runs << ", ±"
+                      << std::setprecision(6) << r.stats.stddev << ")";
+        }
+        std::cout << "\n";
+    } else if (r.timed_out) {
+        std::cout << "⏱ TIMEOUT after " << std::fixed << std::setprecision(2) << r.time_seconds
+                  << " s (incumbent: " << r.clique_size << ", nodes: " << r.nodes << ")\n";
+    } else if (r.status() == "SKIPPED") {
+        std::cout << "⊘ SKIPPED (" << r.error.substr(std::string("Skipped: ").size()) << ")\n";
+    } else {
+        std::cout << "✗ " << r.error << "\n";
+    }
+}
+
+// Run one algorithm unless the skip policy excludes it, and print its progress line
+// Every run, warmups excluded, is appended to samples
+void run_step(const std::string& label, const std::string& name,
+              const GraphStats& stats, const BenchmarkOptions& options,
+              const std::function<BenchmarkResult(unsigned int)>& run,
+              std::vector<BenchmarkResult>& results,
+              std::vector<BenchmarkResult>& samples) {
+    std::cout << label;
+    
+    BenchmarkResult skipped;
+    if (skip_result(name, stats, options, skipped)) {
+        print_outcome(skipped);
+        results.push_back(skipped);
+        return;
+    }
+    
+    const RepeatConfig& repeat = options.repeat;
+    auto run_indexed = [&](int i) {
+        int measured = std::max(i - repeat.warmup, 0);
+        return run_once(name, run, run_seed(repeat, measured), repeat.min_time, options.perf);
+    };
+    int count = repeat.warmup + repeat.repeat;
+    
+    std::cout.flush();
+    std::vector<BenchmarkResult> runs;
+    if (options.isolation.enabled) {
+        runs = run_isolated(name, options.isolation, count, run_indexed);
+    } else {
+        for (int i = 0; i < count; i++) {
+            runs.push_back(run_indexed(i));
+            runs.back().algorithm = name;
+        }
+    }
+    
+    // The heap grows in the first run, so memory counts warmups too
+    size_t memory_kb = 0;
+    for (const auto& run_result : runs) {
+        memory_kb = std::max(memory_kb, run_result.memory_kb);
+    }
+    
+    // Drop warmups, unless the child died before measuring anything
+    if ((int)runs.size() > repeat.warmup) {
+        runs.erase(runs.begin(), runs.begin() + repeat.warmup);
+    } else {
+        runs.erase(runs.begin(), runs.end() - 1);
+    }
+    samples.insert(samples.end(), runs.begin(), runs.end());
+    
+    BenchmarkResult r = summarize_runs(name, runs);
+    r.memory_kb = memory_kb;
+    results.push_back(r);
+    print_outcome(r);
+}
+
+// One algorithm of a dataset's run, as the scheduler sees it
+struct BenchmarkStep {
+    std::string label;
+    std::string name;
+    int cores = 1;  // CPUs each of its jobs claims
+    std::function<BenchmarkResult(unsigned int)> run;
+};
+
+/**
+ * Run the steps' measured runs as concurrent jobs pinned to their own CPUs
+ *
+ * Every measured run of every step is one job: a forked child, pinned to
+ * the CPUs the allocator hands it, that runs the configured warmups and
+ * then the measured run. Up to schedule.jobs jobs run at once, started in
+ * step order as CPUs free up. A step's progress line is printed when its
+ * last job finishes, so lines appear in completion order; results and
+ * samples keep step order as in run_step.
+ */
+void run_scheduled(const std::vector<BenchmarkStep>& steps, const GraphStats& stats,
+                   const BenchmarkOptions& options,
+                   std::vector<BenchmarkResult>& results,
+                   std::vector<BenchmarkResult>& samples) {
+    const RepeatConfig& repeat = options.repeat;
+    CoreAllocator allocator(options.schedule.cpus);
+    
+    struct StepRuns {
+        bool skipped = false;
+        BenchmarkResult result;
+        std::vector<BenchmarkResult> runs;  // Measured runs, by index
+        size_t memory_kb = 0;
+        int pending = 0;
+    };
+    std::vector<StepRuns> progress(steps.size());
+    std::vector<std::pair<size_t, int>> jobs;  // Step, measured run
+    
+    for (size_t k = 0; k < steps.size(); k++) {
+        StepRuns& p = progress[k];
+        if (skip_result(steps[k].name, stats, options, p.result)) {
+            p.skipped = true;
+            std::cout << steps[k].label;
+            print_outcome(p.result);
+            continue;
+        }
+        p.runs.resize(repeat.repeat);
+        p.pending = repeat.repeat;
+        for (int m = 0; m < repeat.repeat; m++) {
+            jobs.push_back({k, m});
+        }
+    }
+    std::cout.flush();
+    
+    std::mutex mutex;  // Guards next_job, progress and std::cout
+    size_t next_job = 0;
+    auto worker = [&]() {
+        while (true) {
+            std::unique_lock<std::mutex> lock(mutex);
+            if (next_job >= jobs.size()) return;
+            size_t k = jobs[next_job].first;
+            int m = jobs[next_job].second;
+            next_job++;
+            lock.unlock();
+            
+            const BenchmarkStep& step = steps[k];
+            std::vector<int> cpus = allocator.acquire(step.cores);
+            std::vector<BenchmarkResult> runs = run_isolated(
+                step.name, options.isolation, repeat.warmup + 1,
+                [&](int) {
+                    return run_once(step.name, step.run, run_seed(repeat, m), repeat.min_time,
+                                    options.perf);
+                },
+                cpus);
+            allocator.release(cpus);
+            
+            lock.lock();
+            StepRuns& p = progress[k];
+            for (const auto& run_result : runs) {
+                p.memory_kb = std::max(p.memory_kb, run_result.memory_kb);
+            }
+            // The last result is the measured run, or why the child died before it
+            p.runs[m] = runs.back();
+            if (--p.pending == 0) {
+                p.result = summarize_runs(step.name, p.runs);
+                p.result.memory_kb = p.memory_kb;
+                std::cout << step.label;
+                print_outcome(p.result);
+                std::cout.flush();
+            }
+        }
+    };
+    
+    int workers = std::min<int>(std::max(options.schedule.jobs, 1), jobs.size());
+    std::vector<std::thread> pool;
+    for (int t = 0; t < workers; t++) {
+        pool.emplace_back(worker);
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
     
+    for (const auto& p : progress) {
+        results.push_back(p.result);
+        samples.insert(samples.end(), p.runs.begin(), p.runs.end());
+    }
+}
+
+// Banner printed before each dataset
+static void print_dataset_banner(const std::string& dataset_name) {
     std::cout << std::fixed << std::setprecision(6);
     std::cout << "\n";
     std::cout << "========================================================================================================\n";
@@ -201,21 +838,18 @@ int main(int argc, char* argv[]) {
     std::cout << "========================================================================================================\n";
     std::cout << "Dataset: " << dataset_name << "\n";
     std::cout << "========================================================================================================\n\n";
-    
-    // Load graph
-    std::cout << "Loading graph...\n";
-    Graph g;
-    try {
-        g = Graph::load_from_snap(filename);
-    } catch (const std::exception& e) {
-        std::cerr << "Error loading graph: " << e.what() << std::endl;
-        return 1;
-    }
-    
-    // Compute graph statistics
-    GraphStats stats;
-    stats.compute(g);
-    
+}
+
+/**
+ * Run every algorithm on one loaded graph
+ *
+ * Prints the graph statistics and progress, writes
+ * benchmark_detailed_<dataset>.csv (and benchmark_runs_<dataset>.csv with
+ * --repeat), prints the summary tables and returns one row per algorithm.
+ * Turns options.perf off if no hardware counter can be opened.
+ */
+std::vector<BenchmarkResult> benchmark_dataset(const std::string& dataset_name, const Graph& g,
+                                               const GraphStats& stats, BenchmarkOptions& options) {
     std::cout << "\nGRAPH STATISTICS:\n";
     std::cout << "--------------------------------------------------------------------------------------------------------\n";
     std::cout << "  Vertices:      " << std::setw(10) << stats.num_vertices << "\n";
@@ -224,146 +858,66 @@ int main(int argc, char* argv[]) {
     std::cout << "  Max Degree:    " << std::setw(10) << stats.max_degree << "\n";
     std::cout << "  Avg Degree:    " << std::setw(10) << std::fixed << std::setprecision(2) << stats.avg_degree << "\n";
     std::cout << "  Degeneracy:    " << std::setw(10) << stats.degeneracy << "\n";
+    if (options.perf) {
+        PerfCounters probe;
+        std::cout << "  HW counters:   " << std::setw(10)
+                  << (probe.available() ? "on" : "off") << "\n";
+        if (!probe.available()) {
+            options.perf = false;
+            std::cout << "  (perf_event_open failed; check perf_event_paranoid or run on bare metal)\n";
+        }
+    }
     std::cout << "--------------------------------------------------------------------------------------------------------\n\n";
     
     // Run all algorithms
     std::vector<BenchmarkResult> results;
+    std::vector<BenchmarkResult> samples;
     
     std::cout << "RUNNING ALGORITHMS:\n";
     std::cout << "========================================================================================================\n\n";
     
-    // 1. Greedy
-    std::cout << "[1/11] Greedy Heuristic...                    ";
-    std::cout.flush();
-    auto r1 = run_greedy(g);
-    results.push_back(r1);
-    if (r1.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r1.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r1.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r1.error << "\n";
-    }
-    
-    // 2. Randomized Heuristic
-    std::cout << "[2/11] Randomized Heuristic...                ";
-    std::cout.flush();
-    auto r2 = run_randomized(g);
-    results.push_back(r2);
-    if (r2.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r2.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r2.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r2.error << "\n";
-    }
-    
-    // 3. Simulated Annealing
-    std::cout << "[3/11] Simulated Annealing...                 ";
-    std::cout.flush();
-    auto r3 = run_simulated_annealing(g);
-    results.push_back(r3);
-    if (r3.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r3.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r3.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r3.error << "\n";
-    }
-    
-    // 4. Bron-Kerbosch (skip if too large or too dense)
-    if (stats.num_vertices <= 1000 && stats.density <= 0.5) {
-        std::cout << "[4/11] Bron-Kerbosch (Vanilla)...             ";
-        std::cout.flush();
-        auto r4 = run_algorithm<BronKerbosch>(g, "Bron-Kerbosch");
-        results.push_back(r4);
-        if (r4.success) {
-            std::cout << "✓ Size: " << std::setw(3) << r4.clique_size 
-                      << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r4.time_seconds << " s\n";
-        } else {
-            std::cout << "✗ " << r4.error << "\n";
+    std::vector<SolverSelection> selected = options.solvers;
+    if (selected.empty()) {
+        for (const auto& solver : solver_registry()) {
+            if (solver.runs_by_default) selected.push_back({&solver, SolverOptions()});
         }
-    } else {
-        std::string reason = stats.num_vertices > 1000 ? ">1000 vertices" : "density > 0.5";
-        std::cout << "[4/11] Bron-Kerbosch (Vanilla)...             ⊘ SKIPPED (" << reason << ")\n";
-        results.push_back({"Bron-Kerbosch", 0, 0.0, 0, false, "Skipped: " + reason});
-    }
-    
-    // 5. Tomita
-    std::cout << "[5/11] Tomita (BK with Pivoting)...           ";
-    std::cout.flush();
-    auto r5 = run_algorithm<TomitaAlgorithm>(g, "Tomita");
-    results.push_back(r5);
-    if (r5.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r5.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r5.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r5.error << "\n";
-    }
-    
-    // 6. Degeneracy BK
-    std::cout << "[6/11] Degeneracy Bron-Kerbosch...            ";
-    std::cout.flush();
-    auto r6 = run_algorithm<DegeneracyBK>(g, "Degeneracy BK");
-    results.push_back(r6);
-    if (r6.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r6.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r6.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r6.error << "\n";
-    }
-    
-    // 7. Östergård
-    std::cout << "[7/11] Östergård...                           ";
-    std::cout.flush();
-    auto r7 = run_algorithm<OstergardAlgorithm>(g, "Ostergard");
-    results.push_back(r7);
-    if (r7.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r7.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r7.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r7.error << "\n";
     }
     
-    // 8. BBMC
-    std::cout << "[8/11] BBMC...                                ";
-    std::cout.flush();
-    auto r8 = run_bbmc(g);
-    results.push_back(r8);
-    if (r8.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r8.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r8.time_seconds << " s\n";
-    } else {
-        std::cout << "✗ " << r8.error << "\n";
-    }
-    
-    // 9. CPU Optimized (skip if >1000 vertices OR density >0.5 OR >8192 vertices)
-    if (stats.num_vertices > 1000 || stats.density > 0.5) {
-        std::cout << "[9/11] CPU Optimized...                       ⊘ SKIPPED (vertices > 1000 or density > 0.5)\n";
-        results.push_back({"CPU Optimized", 0, 0.0, 0, false, "Skipped: graph too large/dense"});
-    } else if (stats.num_vertices <= 8192) {
-        std::cout << "[9/11] CPU Optimized...                       ";
-        std::cout.flush();
-        auto r9 = run_algorithm<CPUOptimized>(g, "CPU Optimized");
-        results.push_back(r9);
-        if (r9.success) {
-            std::cout << "✓ Size: " << std::setw(3) << r9.clique_size 
-                      << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r9.time_seconds << " s\n";
-        } else {
-            std::cout << "✗ " << r9.error << "\n";
+    std::vector<BenchmarkStep> steps;
+    for (size_t k = 0; k < selected.size(); k++) {
+        SolverSelection selection = selected[k];
+        BenchmarkStep step;
+        step.name = selection.solver->name;
+        step.label = "[" + std::to_string(k + 1) + "/" + std::to_string(selected.size()) + "] " +
+                     selection.solver->title + "...";
+        // Pad by display width; UTF-8 continuation bytes take no column
+        size_t width = 0;
+        for (unsigned char c : step.label) {
+            if ((c & 0xC0) != 0x80) width++;
         }
-    } else {
-        std::cout << "[9/11] CPU Optimized...                       ⊘ SKIPPED (>8192 vertices)\n";
-        results.push_back({"CPU Optimized", 0, 0.0, 0, false, "Skipped: too large"});
+        step.label.append(width < 47 ? 47 - width : 1, ' ');
+        
+        // A scheduled multi-threaded solver runs one thread per claimed CPU
+        std::string thread_option = selection.solver->thread_option();
+        if (options.schedule.jobs > 0 && !thread_option.empty()) {
+            step.cores = options.schedule.job_cores;
+            if (!selection.options.has(thread_option)) {
+                selection.options.set(thread_option, std::to_string(step.cores));
+            }
+        }
+        double timeout = options.timeout;
+        step.run = [selection, &g, timeout](unsigned int seed) {
+            return run_solver(selection, g, timeout, seed);
+        };
+        steps.push_back(step);
     }
     
-    // 10. MaxCliqueDyn
-    std::cout << "[10/11] MaxCliqueDyn (Tomita + Coloring)...   ";
-    std::cout.flush();
-    auto r10 = run_algorithm<MaxCliqueDyn>(g, "MaxCliqueDyn");
-    results.push_back(r10);
-    if (r10.success) {
-        std::cout << "✓ Size: " << std::setw(3) << r10.clique_size 
-                  << ", Time: " << std::setw(10) << std::fixed << std::setprecision(6) << r10.time_seconds << " s\n";
+    if (options.schedule.jobs > 0) {
+        run_scheduled(steps, stats, options, results, samples);
     } else {
-        std::cout << "✗ " << r10.error << "\n";
+        for (const auto& step : steps) {
+            run_step(step.label, step.name, stats, options, step.run, results, samples);
+        }
     }
     
     std::cout << "\n========================================================================================================\n";
@@ -375,7 +929,11 @@ int main(int argc, char* argv[]) {
     std::ofstream csv(csv_filename);
     
     csv << "Dataset,Vertices,Edges,Density,MaxDegree,AvgDegree,Degeneracy,";
-    csv << "Algorithm,CliqueSize,Time(s),Memory(KB),Success\n";
+    csv << "Algorithm,CliqueSize,Time(s),Memory(KB),Success,Status,Nodes,PeakRSS(KB),CPU(s),";
+    csv << "Runs,TimeMin,TimeMedian,TimeMean,TimeStddev,TimeCI95Low,TimeCI95High,CliqueSizeMean,CliqueSizes,";
+    csv << "AllocBytes,Allocations,PeakLiveBytes,AllocsPerNode,";
+    csv << "Cycles,Instructions,IPC,L1DMisses,LLCMisses,BranchMisses,DTLBMisses,";
+    csv << "MaxDepth,Leaves,SizePrunes,ColoringPrunes,SuffixPrunes,IncumbentUpdates,TimeToBest(s),DepthHistogram\n";
     
     for (const auto& r : results) {
         csv << dataset_name << ","
@@ -387,18 +945,142 @@ int main(int argc, char* argv[]) {
             << stats.degeneracy << ","
             << r.algorithm << ",";
         
-        if (r.success) {
+        // Timeouts still report the incumbent and the time spent
+        if (r.success || r.timed_out) {
             csv << r.clique_size << ","
                 << std::fixed << std::setprecision(6) << r.time_seconds << ","
                 << r.memory_kb << ","
-                << "true\n";
+                << (r.success ? "true" : "false") << ",";
+        } else {
+            csv << "N/A,N/A,N/A,false,";
+        }
+        csv << r.status() << ",";
+        if (r.nodes >= 0) {
+            csv << r.nodes << ",";
+        } else {
+            csv << "N/A,";
+        }
+        // Skipped runs have no rusage; in-process runs have no child peak RSS
+        if (r.peak_rss_kb >= 0) {
+            csv << r.peak_rss_kb << ",";
+        } else {
+            csv << "N/A,";
+        }
+        if (r.cpu_seconds >= 0) {
+            csv << std::fixed << std::setprecision(6) << r.cpu_seconds << ",";
+        } else {
+            csv << "N/A,";
+        }
+        
+        const RunStatistics& st = r.stats;
+        if (st.runs > 0) {
+            csv << st.runs << ","
+                << std::fixed << std::setprecision(6) << st.min << ","
+                << st.median << ","
+                << st.mean << ","
+                << st.stddev << ","
+                << st.ci_low << ","
+                << st.ci_high << ","
+                << std::setprecision(2) << st.mean_clique_size << ","
+                << st.distribution() << ",";
+        } else {
+            csv << "0,N/A,N/A,N/A,N/A,N/A,N/A,N/A,N/A,";
+        }
+        
+        // Heap columns need a TRACK_ALLOCATIONS build
+        if ((r.success || r.timed_out) && r.alloc_bytes >= 0) {
+            csv << r.alloc_bytes << ","
+                << r.allocations << ","
+                << r.peak_live_bytes << ",";
+            if (r.nodes > 0) {
+                csv << std::fixed << std::setprecision(2) << (double)r.allocations / r.nodes << ",";
+            } else {
+                csv << "N/A,";
+            }
+        } else {
+            csv << "N/A,N/A,N/A,N/A,";
+        }
+        
+        // Counters the CPU or kernel does not provide read N/A
+        bool counted = r.success || r.timed_out;
+        auto counter = [&](PerfReading::Event e) {
+            if (counted && r.perf.has(e)) {
+                csv << r.perf.values[e];
+            } else {
+                csv << "N/A";
+            }
+        };
+        counter(PerfReading::CYCLES);
+        csv << ",";
+        counter(PerfReading::INSTRUCTIONS);
+        csv << ",";
+        if (counted && r.perf.ipc() >= 0) {
+            csv << std::fixed << std::setprecision(3) << r.perf.ipc() << ",";
+        } else {
+            csv << "N/A,";
+        }
+        counter(PerfReading::L1D_MISSES);
+        csv << ",";
+        counter(PerfReading::LLC_MISSES);
+        csv << ",";
+        counter(PerfReading::BRANCH_MISSES);
+        csv << ",";
+        counter(PerfReading::DTLB_MISSES);
+        csv << ",";
+        
+        // Search-tree columns need a SEARCH_STATS build and an exact solver
+        const SearchSummary& t = r.search;
+        if (counted && t.recorded()) {
+            csv << t.max_depth << ","
+                << t.leaves << ","
+                << t.size_prunes << ","
+                << t.coloring_prunes << ","
+                << t.suffix_prunes << ","
+                << t.incumbent_updates << ","
+                << std::fixed << std::setprecision(6) << t.time_to_best << ","
+                << r.depth_histogram << "\n";
         } else {
-            csv << "N/A,N/A,N/A,false\n";
+            csv << "N/A,N/A,N/A,N/A,N/A,N/A,N/A,N/A\n";
         }
     }
     
     csv.close();
-    std::cout << "CSV file saved: " << csv_filename << "\n\n";
+    std::cout << "CSV file saved: " << csv_filename << "\n";
+    
+    // Per-run CSV, so distributions can be re-analyzed offline
+    if (options.repeat.repeat > 1) {
+        std::string runs_filename = "benchmark_runs_" + dataset_name + ".csv";
+        std::ofstream runs_csv(runs_filename);
+        runs_csv << "Dataset,Algorithm,Run,Seed,Calls,CliqueSize,Time(s),CPU(s),Status,Nodes\n";
+        
+        std::map<std::string, int> run_index;
+        for (const auto& r : samples) {
+            runs_csv << dataset_name << ","
+                     << r.algorithm << ","
+                     << run_index[r.algorithm]++ << ","
+                     << r.seed << ","
+                     << r.calls << ",";
+            if (r.success || r.timed_out) {
+                runs_csv << r.clique_size << ","
+                         << std::fixed << std::setprecision(6) << r.time_seconds << ",";
+            } else {
+                runs_csv << "N/A,N/A,";
+            }
+            if (r.cpu_seconds >= 0) {
+                runs_csv << std::fixed << std::setprecision(6) << r.cpu_seconds << ",";
+            } else {
+                runs_csv << "N/A,";
+            }
+            runs_csv << r.status() << ",";
+            if (r.nodes >= 0) {
+                runs_csv << r.nodes << "\n";
+            } else {
+                runs_csv << "N/A\n";
+            }
+        }
+        std::cout << "CSV file saved: " << runs_filename << "\n";
+    }
+    std::cout << "\n";
     
     // Print summary table
     std::cout << "RESULTS SUMMARY:\n";
@@ -406,22 +1088,589 @@ int main(int argc, char* argv[]) {
     std::cout << std::left << std::setw(30) << "Algorithm" 
               << std::right << std::setw(12) << "Clique Size" 
               << std::setw(15) << "Time (s)" 
-              << std::setw(15) << "Memory (KB)" << "\n";
+              << std::setw(15) << "Memory (KB)"
+              << std::setw(10) << "Status" << "\n";
     std::cout << "--------------------------------------------------------------------------------------------------------\n";
     
     for (const auto& r : results) {
         std::cout << std::left << std::setw(30) << r.algorithm;
-        if (r.success) {
+        if (r.success || r.timed_out) {
             std::cout << std::right << std::setw(12) << r.clique_size
                       << std::setw(15) << std::fixed << std::setprecision(6) << r.time_seconds
-                      << std::setw(15) << r.memory_kb << "\n";
+                      << std::setw(15) << r.memory_kb;
         } else {
-            std::cout << std::right << std::setw(12) << "FAILED"
+            std::cout << std::right << std::setw(12) << (r.status() == "SKIPPED" ? "-" : "FAILED")
                       << std::setw(15) << "N/A"
-                      << std::setw(15) << "N/A" << "\n";
+                      << std::setw(15) << "N/A";
+        }
+        std::cout << std::setw(10) << r.status() << "\n";
+    }
+    std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    
+    if (AllocationTracker::enabled()) {
+        std::cout << "\nHEAP ALLOCATIONS (per call):\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        std::cout << std::left << std::setw(30) << "Algorithm"
+                  << std::right << std::setw(16) << "Bytes"
+                  << std::setw(14) << "Allocations"
+                  << std::setw(16) << "Peak Live (B)"
+                  << std::setw(14) << "Allocs/Node" << "\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        
+        for (const auto& r : results) {
+            if (!(r.success || r.timed_out) || r.alloc_bytes < 0) continue;
+            std::cout << std::left << std::setw(30) << r.algorithm
+                      << std::right << std::setw(16) << r.alloc_bytes
+                      << std::setw(14) << r.allocations
+                      << std::setw(16) << r.peak_live_bytes;
+            if (r.nodes > 0) {
+                std::cout << std::setw(14) << std::fixed << std::setprecision(2)
+                          << (double)r.allocations / r.nodes << "\n";
+            } else {
+                std::cout << std::setw(14) << "N/A" << "\n";
+            }
+        }
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    }
+    
+    if (SearchStatsRecorder::enabled()) {
+        std::cout << "\nSEARCH TREE (prunes by bound: size |C|+|P|, coloring |C|+colors, suffix |C|+c[j]):\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        std::cout << std::left << std::setw(22) << "Algorithm"
+                  << std::right << std::setw(14) << "Nodes"
+                  << std::setw(7) << "Depth"
+                  << std::setw(13) << "Leaves"
+                  << std::setw(12) << "Size"
+                  << std::setw(12) << "Coloring"
+                  << std::setw(10) << "Suffix"
+                  << std::setw(6) << "Incs"
+                  << std::setw(14) << "To best (s)" << "\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        
+        for (const auto& r : results) {
+            const SearchSummary& t = r.search;
+            if (!(r.success || r.timed_out) || !t.recorded()) continue;
+            std::cout << std::left << std::setw(22) << r.algorithm
+                      << std::right << std::setw(14) << r.nodes
+                      << std::setw(7) << t.max_depth
+                      << std::setw(13) << t.leaves
+                      << std::setw(12) << t.size_prunes
+                      << std::setw(12) << t.coloring_prunes
+                      << std::setw(10) << t.suffix_prunes
+                      << std::setw(6) << t.incumbent_updates
+                      << std::setw(14) << std::fixed << std::setprecision(6) << t.time_to_best << "\n";
+        }
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    }
+    
+    if (options.perf) {
+        std::cout << "\nHARDWARE COUNTERS (per call; misses per 1000 instructions):\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        std::cout << std::left << std::setw(30) << "Algorithm"
+                  << std::right << std::setw(16) << "Instructions"
+                  << std::setw(8) << "IPC"
+                  << std::setw(12) << "L1D MPKI"
+                  << std::setw(12) << "LLC MPKI"
+                  << std::setw(12) << "Br MPKI"
+                  << std::setw(12) << "dTLB MPKI" << "\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        
+        for (const auto& r : results) {
+            if (!(r.success || r.timed_out) || !r.perf.has(PerfReading::INSTRUCTIONS)) continue;
+            double kilo_instructions = r.perf.values[PerfReading::INSTRUCTIONS] / 1000.0;
+            auto mpki = [&](PerfReading::Event e) {
+                std::ostringstream out;
+                if (r.perf.has(e) && kilo_instructions > 0) {
+                    out << std::fixed << std::setprecision(2) << r.perf.values[e] / kilo_instructions;
+                } else {
+                    out << "N/A";
+                }
+                return out.str();
+            };
+            std::ostringstream ipc;
+            if (r.perf.ipc() >= 0) {
+                ipc << std::fixed << std::setprecision(2) << r.perf.ipc();
+            } else {
+                ipc << "N/A";
+            }
+            std::cout << std::left << std::setw(30) << r.algorithm
+                      << std::right << std::setw(16) << r.perf.values[PerfReading::INSTRUCTIONS]
+                      << std::setw(8) << ipc.str()
+                      << std::setw(12) << mpki(PerfReading::L1D_MISSES)
+                      << std::setw(12) << mpki(PerfReading::LLC_MISSES)
+                      << std::setw(12) << mpki(PerfReading::BRANCH_MISSES)
+                      << std::setw(12) << mpki(PerfReading::DTLB_MISSES) << "\n";
+        }
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    }
+    
+    if (options.repeat.repeat > 1) {
+        std::cout << "\nTIMING STATISTICS (" << options.repeat.repeat << " runs, "
+                  << options.repeat.warmup << " warmup):\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        std::cout << std::left << std::setw(22) << "Algorithm"
+                  << std::right << std::setw(12) << "Min (s)"
+                  << std::setw(12) << "Median (s)"
+                  << std::setw(12) << "Mean (s)"
+                  << std::setw(12) << "Stddev"
+                  << std::setw(26) << "95% CI (s)"
+                  << "  Clique sizes\n";
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+        
+        for (const auto& r : results) {
+            const RunStatistics& st = r.stats;
+            if (st.runs == 0) continue;
+            std::ostringstream ci;
+            ci << std::fixed << std::setprecision(6) << "[" << st.ci_low << ", " << st.ci_high << "]";
+            std::cout << std::left << std::setw(22) << r.algorithm
+                      << std::right << std::fixed << std::setprecision(6)
+                      << std::setw(12) << st.min
+                      << std::setw(12) << st.median
+                      << std::setw(12) << st.mean
+                      << std::setw(12) << st.stddev
+                      << std::setw(26) << ci.str()
+                      << "  " << st.distribution() << "\n";
+        }
+        std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    }
+    
+    return results;
+}
+
+// JSON string literal with quotes and control characters escaped
+static std::string json_string(const std::string& value) {
+    std::ostringstream out;
+    out << '"';
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c
+                << std::dec << std::setfill(' ');
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+    return out.str();
+}
+
+/**
+ * Append one dataset's rows to the consolidated batch output
+ *
+ * Columns match benchmark_all_*.csv as written by the notebook: density
+ * in percent, spaces in algorithm names replaced by underscores, and
+ * Success as True/False. Timeouts keep their incumbent and time; other
+ * failures leave CliqueSize and Time empty (null in JSON lines).
+ */
+static void write_consolidated(std::ostream& out, bool jsonl, const LoadedDataset& d,
+                               const std::vector<BenchmarkResult>& results) {
+    for (const auto& r : results) {
+        std::string algorithm = r.algorithm;
+        std::replace(algorithm.begin(), algorithm.end(), ' ', '_');
+        bool measured = r.success || r.timed_out;
+        std::ostringstream density, time;
+        density << std::fixed << std::setprecision(4) << d.stats.density * 100;
+        time << std::fixed << std::setprecision(6) << r.time_seconds;
+        
+        if (jsonl) {
+            out << "{\"Dataset\": " << json_string(d.entry.name)
+                << ", \"Category\": " << json_string(d.entry.category)
+                << ", \"Vertices\": " << d.stats.num_vertices
+                << ", \"Edges\": " << d.stats.num_edges
+                << ", \"Density\": " << density.str()
+                << ", \"Algorithm\": " << json_string(algorithm)
+                << ", \"CliqueSize\": " << (measured ? std::to_string(r.clique_size) : "null")
+                << ", \"Time(s)\": " << (measured ? time.str() : "null")
+                << ", \"Success\": " << (r.success ? "true" : "false") << "}\n";
+        } else {
+            out << d.entry.name << ","
+                << d.entry.category << ","
+                << d.stats.num_vertices << ","
+                << d.stats.num_edges << ","
+                << density.str() << ","
+                << algorithm << ","
+                << (measured ? std::to_string(r.clique_size) : "") << ","
+                << (measured ? time.str() : "") << ","
+                << (r.success ? "True" : "False") << "\n";
+        }
+    }
+}
+
+/**
+ * Benchmark every dataset in entries in one process
+ *
+ * Graphs are parsed and their statistics computed (or read from cache)
+ * on loader threads while the previous dataset's solvers run. Rows are
+ * appended to the consolidated output and flushed after each dataset,
+ * so an interrupted sweep keeps what it finished. Isolated runs fork
+ * while a loader may be parsing; the child only has the forking thread
+ * and never touches the loader, and glibc keeps malloc usable across fork.
+ * @return Number of datasets that could not be loaded
+ */
+int run_batch(const std::vector<DatasetEntry>& entries, BenchmarkOptions& options,
+              int loaders, const std::string& output, GraphStatsCache* cache) {
+    bool jsonl = output.size() >= 6 && output.compare(output.size() - 6, 6, ".jsonl") == 0;
+    std::ofstream out(output);
+    if (!out.is_open()) {
+        std::cerr << "Cannot write " << output << std::endl;
+        return (int)entries.size();
+    }
+    if (!jsonl) {
+        out << "Dataset,Category,Vertices,Edges,Density,Algorithm,CliqueSize,Time(s),Success\n";
+    }
+    
+    int failed = 0;
+    int index = 0;
+    DatasetLoader loader(entries, loaders, std::max(loaders, 1), cache);
+    while (std::unique_ptr<LoadedDataset> d = loader.next()) {
+        index++;
+        std::cout << "\n[BATCH " << index << "/" << entries.size() << "] " << d->entry.path
+                  << " (" << d->entry.category << "): loaded in "
+                  << std::fixed << std::setprecision(2) << d->load_seconds << " s"
+                  << (d->stats_cached ? ", cached stats" : "") << "\n";
+        if (!d->error.empty()) {
+            std::cerr << "Error loading graph: " << d->error << std::endl;
+            failed++;
+            continue;
+        }
+        
+        print_dataset_banner(d->entry.name);
+        std::vector<BenchmarkResult> results = benchmark_dataset(d->entry.name, d->graph,
+                                                                 d->stats, options);
+        write_consolidated(out, jsonl, *d, results);
+        out.flush();
+    }
+    
+    if (cache && !cache->save()) {
+        std::cerr << "Warning: could not write the graph statistics cache" << std::endl;
+    }
+    std::cout << "\nBATCH COMPLETE: " << (index - failed) << "/" << entries.size()
+              << " datasets benchmarked\n";
+    std::cout << "Consolidated results saved: " << output << "\n";
+    return failed;
+}
+
+// Print the solver registry for --list-algos
+static void list_solvers() {
+    for (const auto& solver : solver_registry()) {
+        std::cout << solver.name << " (" << (solver.exact ? "exact" : "heuristic")
+                  << (solver.runs_by_default ? "" : ", not run by default") << ")\n";
+        for (const auto& option : solver.options) {
+            std::string key = option.key + "=" + option.default_value;
+            std::cout << "    " << std::left << std::setw(24) << key << option.description << "\n";
+        }
+    }
+}
+
+// Outcome of one side of a comparison, e.g. "0.052264 s ±0.0012 (n=5), 11"
+static std::string describe_series(const ResultSeries& s) {
+    std::ostringstream out;
+    if (s.runs == 0) {
+        out << (s.skipped ? "SKIPPED" : "FAILED");
+        return out.str();
+    }
+    out << std::fixed << std::setprecision(6) << s.mean << " s";
+    if (s.runs > 1) {
+        out << " ±" << std::setprecision(6) << s.stddev() << " (n=" << s.runs << ")";
+    }
+    out << ", " << s.best_size;
+    if (s.failed > 0) out << " (" << s.failed << " unfinished)";
+    return out.str();
+}
+
+/**
+ * --compare: match a baseline and a new results CSV and report regressions
+ * @return 0 if nothing regressed, 2 on a regression, 1 if a file cannot be read
+ */
+static int run_compare(const std::string& baseline_file, const std::string& current_file,
+                       const CompareOptions& options) {
+    std::map<ResultKey, ResultSeries> baseline, current;
+    std::string error;
+    if (!load_results(baseline_file, baseline, error) || !load_results(current_file, current, error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    
+    std::vector<ResultKey> only_baseline, only_current;
+    std::vector<ResultComparison> comparisons =
+        compare_results(baseline, current, options, only_baseline, only_current);
+    
+    std::cout << "\nREGRESSION CHECK (slowdowns over " << std::fixed << std::setprecision(1)
+              << options.max_slowdown * 100 << "% at 5% significance):\n";
+    std::cout << "  Baseline: " << baseline_file << "\n";
+    std::cout << "  New:      " << current_file << "\n";
+    std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    std::cout << std::left << std::setw(20) << "Dataset"
+              << std::setw(20) << "Algorithm"
+              << std::setw(33) << "Baseline (time, size)"
+              << std::setw(33) << "New (time, size)"
+              << std::right << std::setw(9) << "Change"
+              << "  Verdict\n";
+    std::cout << "--------------------------------------------------------------------------------------------------------\n";
+    
+    int regressions = 0;
+    for (const auto& c : comparisons) {
+        std::string verdict;
+        if (c.stopped) {
+            verdict = "REGRESSION: no longer finishes";
+        } else if (c.smaller) {
+            verdict = "REGRESSION: clique " + std::to_string(c.baseline.best_size) + " -> " +
+                      std::to_string(c.current.best_size);
+        } else if (c.slower) {
+            verdict = "REGRESSION: slower";
+        } else if (c.faster) {
+            verdict = "faster";
+        } else if (!c.tested && c.change > options.max_slowdown) {
+            verdict = "slower? (single run, not tested)";
+        } else {
+            verdict = "ok";
+        }
+        if (c.regression()) regressions++;
+        
+        std::ostringstream change;
+        if (c.baseline.runs > 0 && c.current.runs > 0) {
+            change << std::showpos << std::fixed << std::setprecision(1) << c.change * 100 << "%";
+        } else {
+            change << "N/A";
         }
+        std::cout << std::left << std::setw(20) << (c.key.first.empty() ? "(all)" : c.key.first)
+                  << std::setw(20) << c.key.second
+                  << std::setw(33) << describe_series(c.baseline)
+                  << std::setw(33) << describe_series(c.current)
+                  << std::right << std::setw(9) << change.str()
+                  << "  " << verdict << "\n";
     }
     std::cout << "--------------------------------------------------------------------------------------------------------\n";
     
+    for (const auto& key : only_baseline) {
+        std::cout << "  Missing from new run: " << key.first << " / " << key.second << "\n";
+    }
+    for (const auto& key : only_current) {
+        std::cout << "  Not in baseline:      " << key.first << " / " << key.second << "\n";
+    }
+    std::cout << comparisons.size() << " pairs compared, " << regressions << " regression(s)\n";
+    return regressions > 0 ? 2 : 0;
+}
+
+// Comprehensive benchmark driver
+//
+// Usage: benchmark_comprehensive <graph_file> [--timeout S] [--skip NAME:MAX_V:MAX_D]... [--no-skip]
+//                                [--mem-limit MB] [--cpu-limit S] [--no-isolate]
+//                                [--repeat N] [--warmup K] [--seed S] [--min-time S] [--no-perf]
+//                                [--algo NAME[:KEY=VALUE,...]]... [--list-algos]
+//                                [--jobs N] [--isolated] [--job-cores N]
+//        benchmark_comprehensive (--manifest FILE | --datasets DIR)... [--loaders N]
+//                                [--out FILE] [--stats-cache FILE] [--no-stats-cache] [options]
+//        benchmark_comprehensive --compare BASELINE.csv NEW.csv [--max-slowdown PCT]
+//
+//   --timeout S              Stop each exact algorithm after S seconds and report its
+//                            incumbent as TIMEOUT (default: no limit)
+//   --skip NAME:MAX_V:MAX_D  Skip algorithm NAME on graphs with more than MAX_V vertices
+//                            or density above MAX_D (-1 = no limit); replaces NAME's rule
+//   --no-skip                Drop the default skip rules (Bron-Kerbosch and CPU Optimized
+//                            above 1000 vertices or density 0.5)
+//   --mem-limit MB           Address-space cap for each algorithm's child process
+//   --cpu-limit S            CPU-time cap for each algorithm's child process
+//   --no-isolate             Run every algorithm in this process instead of a forked child
+//   --repeat N               Measured runs per algorithm (default: 1)
+//   --warmup K               Discarded runs before them (default: 0)
+//   --seed S                 Measured run i seeds the heuristics with S + i (default: 1;
+//                            0 = random seeds)
+//   --min-time S             Repeat calls within a run until they take S seconds and
+//                            report the mean per call (default: one call)
+//   --no-perf                Do not read hardware counters around each run
+//   --algo NAME[:K=V,...]    Run only the named solvers, in the order given, with
+//                            per-solver options (repeatable; NAME may also be all,
+//                            exact, heuristic or default)
+//   --list-algos             Print every registered solver and its options
+//   --jobs N                 Run up to N measured runs at once, each in a child pinned
+//                            to its own CPUs (default: one algorithm after another,
+//                            unpinned)
+//   --isolated               Place jobs on one hyperthread per physical core only
+//   --job-cores N            CPUs claimed by each job of a multi-threaded solver, which
+//                            then runs N threads (default: 1)
+//
+// Batch mode benchmarks many graphs in one process:
+//   --manifest FILE          Datasets listed as "path [category]" per line
+//   --datasets DIR           Every *.txt below DIR, categorized by parent directory
+//   --loaders N              Threads loading upcoming graphs in the background
+//                            (default: 1; 0 = load each graph when its turn comes)
+//   --out FILE               Consolidated results, JSON lines if FILE ends in .jsonl
+//                            (default: benchmark_all_<timestamp>.csv)
+//   --stats-cache FILE       Graph statistics cache (default: graph_stats.cache)
+//   --no-stats-cache         Always recompute graph statistics
+//
+// Comparison mode runs no benchmark; it exits with 2 if NEW regressed against BASELINE:
+//   --compare BASE NEW       Match rows of two results CSVs by (dataset, algorithm) and
+//                            flag slower runs, smaller cliques and runs that stopped finishing
+//   --max-slowdown PCT       Ignore slowdowns up to PCT percent (default: 5); larger ones
+//                            are flagged only if Welch's t-test over the repeated runs
+//                            finds them significant
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <graph_file> [--timeout S] [--skip NAME:MAX_V:MAX_D]... [--no-skip]"
+                  << " [--mem-limit MB] [--cpu-limit S] [--no-isolate]"
+                  << " [--repeat N] [--warmup K] [--seed S] [--min-time S] [--no-perf]"
+                  << " [--algo NAME[:KEY=VALUE,...]]... [--list-algos]"
+                  << " [--jobs N] [--isolated] [--job-cores N]\n"
+                  << "       " << argv[0]
+                  << " (--manifest FILE | --datasets DIR)... [--loaders N] [--out FILE.csv|FILE.jsonl]"
+                  << " [--stats-cache FILE] [--no-stats-cache] [options above]\n"
+                  << "       " << argv[0]
+                  << " --compare BASELINE.csv NEW.csv [--max-slowdown PCT]" << std::endl;
+        return 1;
+    }
+    
+    std::string filename;
+    BenchmarkOptions options;
+    std::vector<DatasetEntry> batch;
+    bool batch_mode = false;
+    int loaders = 1;
+    std::string output;
+    std::string stats_cache = "graph_stats.cache";
+    std::string compare_baseline, compare_current;
+    CompareOptions compare;
+    
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (i == 1 && arg.rfind("--", 0) != 0) {
+            filename = arg;
+        } else if (arg == "--manifest" && i + 1 < argc) {
+            std::string error;
+            if (!read_manifest(argv[++i], batch, error)) {
+                std::cerr << error << std::endl;
+                return 1;
+            }
+            batch_mode = true;
+        } else if (arg == "--datasets" && i + 1 < argc) {
+            std::vector<DatasetEntry> found = find_datasets(argv[++i]);
+            if (found.empty()) {
+                std::cerr << "No *.txt datasets under " << argv[i] << std::endl;
+                return 1;
+            }
+            batch.insert(batch.end(), found.begin(), found.end());
+            batch_mode = true;
+        } else if (arg == "--loaders" && i + 1 < argc) {
+            loaders = std::max(std::atoi(argv[++i]), 0);
+        } else if (arg == "--out" && i + 1 < argc) {
+            output = argv[++i];
+        } else if (arg == "--stats-cache" && i + 1 < argc) {
+            stats_cache = argv[++i];
+        } else if (arg == "--no-stats-cache") {
+            stats_cache.clear();
+        } else if (arg == "--timeout" && i + 1 < argc) {
+            options.timeout = std::atof(argv[++i]);
+        } else if (arg == "--skip" && i + 1 < argc) {
+            if (!options.skip.add_rule(argv[++i])) {
+                std::cerr << "Invalid skip rule: " << argv[i] << " (expected NAME:MAX_V:MAX_D)" << std::endl;
+                return 1;
+            }
+        } else if (arg == "--no-skip") {
+            options.skip.rules.clear();
+        } else if (arg == "--mem-limit" && i + 1 < argc) {
+            options.isolation.memory_mb = std::atol(argv[++i]);
+        } else if (arg == "--cpu-limit" && i + 1 < argc) {
+            options.isolation.cpu_seconds = std::atof(argv[++i]);
+        } else if (arg == "--no-isolate") {
+            options.isolation.enabled = false;
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            options.repeat.repeat = std::max(std::atoi(argv[++i]), 1);
+        } else if (arg == "--warmup" && i + 1 < argc) {
+            options.repeat.warmup = std::max(std::atoi(argv[++i]), 0);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            options.repeat.base_seed = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            options.repeat.min_time = std::atof(argv[++i]);
+        } else if (arg == "--no-perf") {
+            options.perf = false;
+        } else if (arg == "--algo" && i + 1 < argc) {
+            std::string error;
+            if (!select_solvers(argv[++i], options.solvers, error)) {
+                std::cerr << error << " (see --list-algos)" << std::endl;
+                return 1;
+            }
+        } else if (arg == "--list-algos") {
+            list_solvers();
+            return 0;
+        } else if (arg == "--compare" && i + 2 < argc) {
+            compare_baseline = argv[++i];
+            compare_current = argv[++i];
+        } else if (arg == "--max-slowdown" && i + 1 < argc) {
+            compare.max_slowdown = std::max(std::atof(argv[++i]), 0.0) / 100.0;
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            options.schedule.jobs = std::max(std::atoi(argv[++i]), 1);
+        } else if (arg == "--isolated") {
+            options.schedule.isolated = true;
+        } else if (arg == "--job-cores" && i + 1 < argc) {
+            options.schedule.job_cores = std::max(std::atoi(argv[++i]), 1);
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (!compare_baseline.empty()) {
+        if (batch_mode || !filename.empty()) {
+            std::cerr << "--compare reads results; it takes no graph file or datasets" << std::endl;
+            return 1;
+        }
+        return run_compare(compare_baseline, compare_current, compare);
+    }
+    if (batch_mode == !filename.empty()) {
+        std::cerr << "Give either one graph file or --manifest/--datasets" << std::endl;
+        return 1;
+    }
+    
+    ScheduleConfig& schedule = options.schedule;
+    if (schedule.jobs == 0 && (schedule.isolated || schedule.job_cores > 1)) {
+        schedule.jobs = 1;
+    }
+    if (schedule.jobs > 0) {
+        if (!options.isolation.enabled) {
+            std::cerr << "--jobs, --isolated and --job-cores pin forked runs; drop --no-isolate" << std::endl;
+            return 1;
+        }
+        CpuTopology topology = CpuTopology::detect();
+        schedule.cpus = topology.job_cpus(schedule.isolated);
+        std::cout << "Scheduling up to " << schedule.jobs << " concurrent job(s) on "
+                  << schedule.cpus.size() << " CPU(s) of " << topology.cpus().size() << " ("
+                  << topology.physical_cores() << " physical cores"
+                  << (schedule.isolated ? ", hyperthread siblings left idle" : "") << ")\n";
+    }
+    
+    if (batch_mode) {
+        if (output.empty()) {
+            char stamp[32];
+            std::time_t now = std::time(nullptr);
+            std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+            output = std::string("benchmark_all_") + stamp + ".csv";
+        }
+        std::unique_ptr<GraphStatsCache> cache;
+        if (!stats_cache.empty()) {
+            cache.reset(new GraphStatsCache(stats_cache));
+        }
+        return run_batch(batch, options, loaders, output, cache.get()) == 0 ? 0 : 1;
+    }
+    
+    std::string dataset_name = filename.substr(filename.find_last_of("/\\") + 1);
+    print_dataset_banner(dataset_name);
+    
+    // Load graph
+    std::cout << "Loading graph...\n";
+    Graph g;
+    try {
+        g = Graph::load_from_snap(filename);
+    } catch (const std::exception& e) {
+        std::cerr << "Error loading graph: " << e.what() << std::endl;
+        return 1;
+    }
+    
+    // Compute graph statistics
+    GraphStats stats;
+    stats.compute(g);
+    
+    benchmark_dataset(dataset_name, g, stats, options);
     return 0;
 }
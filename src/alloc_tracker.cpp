@@ -0,0 +1,218 @@
+// alloc_tracker.cpp - Per-algorithm heap accounting through global operator new/delete
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <string>
+
+#ifndef ALLOC_TRACKER_HPP
+#define ALLOC_TRACKER_HPP
+
+/**
+ * Heap usage attributed to one tag over one AllocationScope
+ */
+struct AllocationStats {
+    long long bytes = 0;             // Total bytes requested
+    long long allocations = 0;       // Number of operator new calls
+    long long peak_live_bytes = 0;   // Highest live bytes above the level at scope entry
+};
+
+/**
+ * Heap accounting by scoped tag
+ *
+ * Compiled with -DTRACK_ALLOCATIONS, this file replaces the global
+ * operator new and delete. Every block carries a 16-byte header holding
+ * its size and the tag that was active when it was allocated, so a free
+ * is charged to the tag that owns the block, whichever tag is active and
+ * whichever thread frees it. Counters are relaxed atomics, so worker
+ * threads started inside a scope are counted too.
+ *
+ * The active tag is process-wide, not per thread: one algorithm runs at
+ * a time in the benchmark, and its thread pools cannot inherit a
+ * thread-local tag. Threads that run alongside it without belonging to
+ * it, like the batch mode's graph loaders, call untrack_this_thread()
+ * and are always charged to tag 0. Over-aligned new (std::align_val_t)
+ * is not tracked.
+ *
+ * Without TRACK_ALLOCATIONS nothing is replaced and enabled() is false;
+ * scopes still compile and report zeros.
+ */
+class AllocationTracker {
+public:
+    static constexpr int MAX_TAGS = 64;
+
+    static constexpr bool enabled() {
+#ifdef TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Tag ID for name, registered on first use (0 = untagged, also
+     * returned once MAX_TAGS is reached)
+     */
+    static int tag(const std::string& name);
+
+    /**
+     * Tag charged for allocations from now on; returns the previous one
+     */
+    static int activate(int tag_id) {
+        return active_tag.exchange(tag_id, std::memory_order_relaxed);
+    }
+
+    /**
+     * Charge the calling thread's allocations to tag 0 from now on,
+     * whichever tag is active
+     */
+    static void untrack_this_thread() { thread_untracked = true; }
+
+    struct Counters {
+        std::atomic<long long> bytes{0};
+        std::atomic<long long> allocations{0};
+        std::atomic<long long> live_bytes{0};
+        std::atomic<long long> peak_live_bytes{0};
+    };
+
+    static Counters& counters(int tag_id) { return table[tag_id]; }
+
+    static void* allocate(size_t size);
+    static void release(void* block) noexcept;
+
+private:
+    static constexpr size_t HEADER = 16;  // Keeps blocks max_align_t aligned
+
+    static Counters table[MAX_TAGS];
+    static std::atomic<int> active_tag;
+    static thread_local bool thread_untracked;
+    static std::string names[MAX_TAGS];
+    static int num_tags;
+    static std::mutex names_mutex;
+};
+
+/**
+ * RAII tag: allocations inside the scope are charged to name
+ *
+ *   AllocationScope scope("Tomita");
+ *   algo.find_maximum_clique(g);
+ *   AllocationStats used = scope.stats();
+ */
+class AllocationScope {
+public:
+    explicit AllocationScope(const std::string& name);
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    /**
+     * Usage since the scope was entered
+     */
+    AllocationStats stats() const;
+
+private:
+    int tag_id;
+    int previous_tag;
+    long long start_bytes;
+    long long start_allocations;
+    long long start_live_bytes;
+};
+
+#endif // ALLOC_TRACKER_HPP
+
+
+AllocationTracker::Counters AllocationTracker::table[AllocationTracker::MAX_TAGS];
+std::atomic<int> AllocationTracker::active_tag{0};
+thread_local bool AllocationTracker::thread_untracked = false;
+std::string AllocationTracker::names[AllocationTracker::MAX_TAGS];
+int AllocationTracker::num_tags = 1;
+std::mutex AllocationTracker::names_mutex;
+
+int AllocationTracker::tag(const std::string& name) {
+    std::lock_guard<std::mutex> lock(names_mutex);
+    for (int t = 1; t < num_tags; t++) {
+        if (names[t] == name) return t;
+    }
+    if (num_tags == MAX_TAGS) return 0;
+    names[num_tags] = name;
+    return num_tags++;
+}
+
+void* AllocationTracker::allocate(size_t size) {
+    char* block = static_cast<char*>(std::malloc(size + HEADER));
+    if (!block) return nullptr;
+
+    int tag_id = thread_untracked ? 0 : active_tag.load(std::memory_order_relaxed);
+    std::memcpy(block, &size, sizeof(size));
+    std::memcpy(block + sizeof(size), &tag_id, sizeof(tag_id));
+
+    Counters& c = table[tag_id];
+    c.bytes.fetch_add(size, std::memory_order_relaxed);
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    long long live = c.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    long long peak = c.peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak &&
+           !c.peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+    return block + HEADER;
+}
+
+void AllocationTracker::release(void* ptr) noexcept {
+    if (!ptr) return;
+    char* block = static_cast<char*>(ptr) - HEADER;
+
+    size_t size;
+    int tag_id;
+    std::memcpy(&size, block, sizeof(size));
+    std::memcpy(&tag_id, block + sizeof(size), sizeof(tag_id));
+    table[tag_id].live_bytes.fetch_sub(size, std::memory_order_relaxed);
+
+    std::free(block);
+}
+
+AllocationScope::AllocationScope(const std::string& name)
+    : tag_id(AllocationTracker::tag(name)) {
+    AllocationTracker::Counters& c = AllocationTracker::counters(tag_id);
+    start_bytes = c.bytes.load(std::memory_order_relaxed);
+    start_allocations = c.allocations.load(std::memory_order_relaxed);
+    start_live_bytes = c.live_bytes.load(std::memory_order_relaxed);
+    // Peak is measured from here, not from earlier scopes with this tag
+    c.peak_live_bytes.store(start_live_bytes, std::memory_order_relaxed);
+    previous_tag = AllocationTracker::activate(tag_id);
+}
+
+AllocationScope::~AllocationScope() {
+    AllocationTracker::activate(previous_tag);
+}
+
+AllocationStats AllocationScope::stats() const {
+    AllocationTracker::Counters& c = AllocationTracker::counters(tag_id);
+    AllocationStats s;
+    s.bytes = c.bytes.load(std::memory_order_relaxed) - start_bytes;
+    s.allocations = c.allocations.load(std::memory_order_relaxed) - start_allocations;
+    s.peak_live_bytes = c.peak_live_bytes.load(std::memory_order_relaxed) - start_live_bytes;
+    return s;
+}
+
+#ifdef TRACK_ALLOCATIONS
+
+// new[], nothrow and sized forms forward to these in libstdc++ and libc++
+
+void* operator new(size_t size) {
+    void* p = AllocationTracker::allocate(size);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    AllocationTracker::release(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    AllocationTracker::release(p);
+}
+
+#endif // TRACK_ALLOCATIONS
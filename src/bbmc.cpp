@@ -19,6 +19,11 @@ using namespace std;
  * - Greedy coloring for tight upper bounds
  * - Vertex ordering strategies (degree, neighbor degree, min-width)
  * - Branch-and-bound pruning
+ * - Optional collection of every maximum clique, or the top-k largest
+ *   distinct maximal cliques, into a deduplicated CliqueArena
+ * 
+ * The search runs on an explicit SearchStack rather than native recursion,
+ * so the per-node candidate bitsets live on the heap, not the thread stack.
  * 
  * Time complexity: O(3^(n/3)) worst case, much faster in practice
  * Space complexity: O(n^2) for bitsets
@@ -47,11 +52,43 @@ public:
      */
     vector<int> find_maximum_clique();
     
+    /**
+     * Find every maximum clique
+     * Runs the standard search to learn ω, then searches again pruning
+     * with < instead of <= and collects each clique of size ω.
+     * @param limit Maximum number of cliques returned (0 = all)
+     * @return Distinct maximum cliques (partial if timed_out())
+     */
+    vector<vector<int>> find_all_maximum_cliques(size_t limit = 0);
+    
+    /**
+     * Find the k largest distinct maximal cliques
+     * @param k Number of cliques to return
+     * @return Up to k maximal cliques, largest first (partial if timed_out())
+     */
+    vector<vector<int>> find_top_k_cliques(size_t k);
+    
     /**
      * Get number of nodes explored
      */
     long long get_nodes_explored() const { return nodes_explored; }
     
+    /**
+     * Stop after this many seconds; searches return what they have
+     * @param seconds Wall-clock limit per search call (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Search-tree statistics since the last init (empty unless built with -DSEARCH_STATS)
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
     struct Vertex {
         int index;
@@ -70,6 +107,22 @@ private:
         }
     };
     
+    /**
+     * Search node: the clique C is the path of frame vertices from the root
+     */
+    struct Frame {
+        int vertex = -1;               // Vertex added to C at this node
+        bitset<MAX_VERTICES> P;        // Candidate set
+        vector<int> branches;          // P in reverse color order (best first)
+        vector<int> colour;            // Color of each branch vertex
+        size_t next = 0;
+        
+        void exclude(int v) {
+            P.reset(v);
+        }
+        
+    };
+    
     const Graph& graph;
     int n;  // Number of vertices
     OrderingStyle ordering_style;
@@ -83,9 +136,32 @@ private:
     vector<int> best_clique;
     int max_size;
     long long nodes_explored;
+    SearchStatsRecorder recorder;
+    
+    // Multi-solution search state
+    enum SearchMode {
+        BEST_ONLY,     // Keep first clique of maximum size
+        ALL_MAXIMUM,   // Collect every clique of size max_size
+        TOP_K          // Collect the top_k largest maximal cliques
+    };
+    SearchMode mode;
+    CliqueArena solutions;
+    size_t top_k;
+    int collect_threshold;  // TOP_K: prune when bound <= this
+    bool stop_search;       // Set when the solution limit is reached
+    
+    // Time limit
+    double time_limit = 0.0;
+    SearchDeadline deadline;  // Started by init_search
+    bool stopped = false;
+    
+    SearchStack<Frame> stack;
+    bitset<MAX_VERTICES> C;  // Current clique, rebuilt from the stack at leaves
     
     // Core algorithm
-    void bb_max_clique(bitset<MAX_VERTICES>& C, bitset<MAX_VERTICES>& P);
+    bool enter();
+    void step();
+    void leaf();
     
     // Coloring for bounds
     void bb_colour(const bitset<MAX_VERTICES>& P, 
@@ -98,6 +174,14 @@ private:
     
     // Solution management
     void save_solution(const bitset<MAX_VERTICES>& C);
+    void on_leaf(const bitset<MAX_VERTICES>& C);
+    bool prune(int bound) const;
+    bool is_maximal(const bitset<MAX_VERTICES>& C) const;
+    vector<int> to_clique(const bitset<MAX_VERTICES>& C) const;
+    
+    // Search setup shared by all modes
+    void init_search();
+    void run_search();
     
     // Utility
     int count_bits(const bitset<MAX_VERTICES>& bs) const;
@@ -105,7 +189,8 @@ private:
 
 BBMC::BBMC(const Graph& g, OrderingStyle style) 
     : graph(g), n(g.num_vertices()), ordering_style(style), 
-      max_size(0), nodes_explored(0) {
+      max_size(0), nodes_explored(0), mode(BEST_ONLY), top_k(0),
+      collect_threshold(0), stop_search(false) {
     
     if (n > MAX_VERTICES) {
         throw runtime_error("Graph too large for BBMC (max " + 
@@ -117,8 +202,11 @@ BBMC::BBMC(const Graph& g, OrderingStyle style)
     V.resize(n);
 }
 
-vector<int> BBMC::find_maximum_clique() {
+void BBMC::init_search() {
+    deadline.start(time_limit);
+    stopped = false;
     nodes_explored = 0;
+    recorder.start();
     max_size = 0;
     best_clique.clear();
     
@@ -131,68 +219,143 @@ vector<int> BBMC::find_maximum_clique() {
     
     // Order vertices
     order_vertices();
-    
-    // Initialize search
-    bitset<MAX_VERTICES> C;  // Current clique
-    bitset<MAX_VERTICES> P;  // Candidate set
-    
-    C.reset();
+}
+
+void BBMC::run_search() {
+    // Root: C empty, P = all vertices
+    stack.clear();
+    Frame& root = stack.push();
+    root.vertex = -1;
+    root.P.reset();
     for (int i = 0; i < n; i++) {
-        P.set(i);
+        root.P.set(i);
     }
     
-    // Run search
-    bb_max_clique(C, P);
+    stop_search = false;
+    if (enter()) {
+        stopped = !stack.run_until([this](SearchStack<Frame>&) { step(); }, deadline);
+    } else {
+        stack.clear();
+    }
+}
+
+vector<int> BBMC::find_maximum_clique() {
+    init_search();
+    mode = BEST_ONLY;
+    run_search();
     
     return best_clique;
 }
 
-void BBMC::bb_max_clique(bitset<MAX_VERTICES>& C, bitset<MAX_VERTICES>& P) {
+vector<vector<int>> BBMC::find_all_maximum_cliques(size_t limit) {
+    // Phase 1: learn ω with the standard <= pruning
+    find_maximum_clique();
+    if (max_size == 0) {
+        return {};
+    }
+    if (stopped) {
+        // ω unknown; the incumbent is all there is
+        return {best_clique};
+    }
+    
+    // Phase 2: max_size = ω is fixed, keep every branch that can reach it
+    solutions = CliqueArena(limit);
+    mode = ALL_MAXIMUM;
+    run_search();
+    mode = BEST_ONLY;
+    
+    return solutions.to_vectors();
+}
+
+vector<vector<int>> BBMC::find_top_k_cliques(size_t k) {
+    init_search();
+    if (k == 0) {
+        return {};
+    }
+    
+    solutions = CliqueArena();
+    top_k = k;
+    collect_threshold = 0;
+    mode = TOP_K;
+    run_search();
+    mode = BEST_ONLY;
+    
+    solutions.keep_largest(k);
+    return solutions.to_vectors();
+}
+
+bool BBMC::enter() {
     nodes_explored++;
+    recorder.node(stack.depth() - 1);
     
-    int m = P.count();
+    Frame& f = stack.back();
+    int m = f.P.count();
     if (m == 0) {
-        if (C.count() > max_size) {
-            save_solution(C);
-        }
-        return;
+        leaf();
+        return false;
     }
     
     // Color vertices to get upper bound
-    vector<int> U(m);
-    vector<int> colour(m);
-    bb_colour(P, U, colour);
+    f.branches.resize(m);
+    f.colour.resize(m);
+    bb_colour(f.P, f.branches, f.colour);
     
     // Process vertices in reverse color order (best first)
-    for (int i = m - 1; i >= 0; i--) {
-        // Prune: if color + current clique size <= best known, stop
-        if (colour[i] + (int)C.count() <= max_size) {
-            return;
-        }
-        
-        int v = U[i];
-        
-        // Create new candidate set: P ∩ N(v)
-        bitset<MAX_VERTICES> newP = P;
-        newP &= N[v];
-        
-        // Add v to clique
-        C.set(v);
-        
-        // Check if we have a maximal clique
-        if (newP.none()) {
-            if (C.count() > max_size) {
-                save_solution(C);
-            }
-        } else {
-            // Recurse
-            bb_max_clique(C, newP);
-        }
-        
-        // Backtrack
-        P.reset(v);
-        C.reset(v);
+    reverse(f.branches.begin(), f.branches.end());
+    reverse(f.colour.begin(), f.colour.end());
+    f.next = 0;
+    return true;
+}
+
+void BBMC::step() {
+    if (stop_search) {
+        stack.clear();
+        return;
+    }
+    
+    size_t d = stack.depth() - 1;  // |C|
+    Frame& f = stack[d];
+    
+    // Prune: if color + current clique size can't beat best known, stop
+    if (f.next == f.branches.size()) {
+        stack.pop();
+        return;
+    }
+    if (prune(f.colour[f.next] + (int)d)) {
+        recorder.coloring_prune();
+        stack.pop();
+        return;
+    }
+    
+    int v = f.branches[f.next++];
+    
+    // Create new candidate set: P ∩ N(v), with v added to clique
+    Frame& child = stack.push();
+    Frame& parent = stack[d];
+    child.vertex = v;
+    child.P = parent.P;
+    child.P &= N[v];
+    
+    parent.exclude(v);
+    
+    // Check if we have a maximal clique
+    if (child.P.none()) {
+        nodes_explored++;
+        recorder.node(d + 1);
+        leaf();
+        stack.pop();
+    } else if (!enter()) {
+        stack.pop();
+    }
+}
+
+void BBMC::leaf() {
+    recorder.leaf();
+    C.reset();
+    for (size_t d = 1; d < stack.depth(); d++) {
+        C.set(stack[d].vertex);
     }
+    on_leaf(C);
 }
 
 void BBMC::bb_colour(const bitset<MAX_VERTICES>& P, 
@@ -317,16 +480,74 @@ void BBMC::min_width_order(vector<Vertex>& vertices) {
     vertices = result;
 }
 
+vector<int> BBMC::to_clique(const bitset<MAX_VERTICES>& C) const {
+    vector<int> clique;
+    for (int i = 0; i < n; i++) {
+        if (C.test(i)) {
+            clique.push_back(V[i].index);
+        }
+    }
+    return clique;
+}
+
 void BBMC::save_solution(const bitset<MAX_VERTICES>& C) {
-    best_clique.clear();
-    
+    best_clique = to_clique(C);
+    max_size = best_clique.size();
+    recorder.incumbent(max_size);
+}
+
+bool BBMC::prune(int bound) const {
+    switch (mode) {
+        case ALL_MAXIMUM:
+            return bound < max_size;
+        case TOP_K:
+            return bound <= collect_threshold;
+        default:
+            return bound <= max_size;
+    }
+}
+
+bool BBMC::is_maximal(const bitset<MAX_VERTICES>& C) const {
+    // C is maximal iff no vertex is adjacent to every vertex of C
+    bitset<MAX_VERTICES> common;
     for (int i = 0; i < n; i++) {
+        common.set(i);
+    }
+    for (int i = 0; i < n && common.any(); i++) {
         if (C.test(i)) {
-            best_clique.push_back(V[i].index);
+            common &= N[i];
         }
     }
+    return common.none();
+}
+
+void BBMC::on_leaf(const bitset<MAX_VERTICES>& C) {
+    int size = C.count();
     
-    max_size = best_clique.size();
+    if (mode == BEST_ONLY) {
+        if (size > max_size) {
+            save_solution(C);
+        }
+    } else if (mode == ALL_MAXIMUM) {
+        if (size == max_size) {
+            solutions.add(to_clique(C));
+            stop_search = solutions.full();
+        }
+    } else if (size > collect_threshold && is_maximal(C)) {
+        if (size > max_size) {
+            save_solution(C);
+        }
+        solutions.add(to_clique(C));
+        
+        // Once k cliques are held, the k-th largest size is the bound.
+        // Compact lazily at 2k so leaves don't pay for a sort each time.
+        if (solutions.size() >= 2 * top_k) {
+            solutions.keep_largest(top_k);
+            collect_threshold = solutions.min_clique_size();
+        } else if (solutions.size() == top_k && collect_threshold == 0) {
+            collect_threshold = solutions.min_clique_size();
+        }
+    }
 }
 
 int BBMC::count_bits(const bitset<MAX_VERTICES>& bs) const {
@@ -0,0 +1,177 @@
+// bitset_graph.cpp - Dynamic bitsets and bitset adjacency for induced subgraphs
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#ifndef BITSET_GRAPH_HPP
+#define BITSET_GRAPH_HPP
+
+/**
+ * Word-level helpers for runtime-sized bitsets
+ *
+ * A bitset over k elements is stored as ceil(k / 64) 64-bit words.
+ * Unlike std::bitset<MAX_VERTICES>, the size is chosen at runtime, so a
+ * set over a 40-vertex subproblem costs one word instead of 12.5 KB.
+ */
+namespace bitset_ops {
+
+using Word = uint64_t;
+constexpr int WORD_BITS = 64;
+
+inline int num_words(int k) {
+    return (k + WORD_BITS - 1) / WORD_BITS;
+}
+
+inline void set_bit(Word* bs, int i) {
+    bs[i / WORD_BITS] |= Word(1) << (i % WORD_BITS);
+}
+
+inline void reset_bit(Word* bs, int i) {
+    bs[i / WORD_BITS] &= ~(Word(1) << (i % WORD_BITS));
+}
+
+inline bool test_bit(const Word* bs, int i) {
+    return (bs[i / WORD_BITS] >> (i % WORD_BITS)) & 1;
+}
+
+inline int count(const Word* bs, int words) {
+    int c = 0;
+    for (int w = 0; w < words; w++) {
+        c += __builtin_popcountll(bs[w]);
+    }
+    return c;
+}
+
+inline bool none(const Word* bs, int words) {
+    for (int w = 0; w < words; w++) {
+        if (bs[w]) return false;
+    }
+    return true;
+}
+
+/**
+ * Index of lowest set bit, or -1 if the set is empty
+ */
+inline int first(const Word* bs, int words) {
+    for (int w = 0; w < words; w++) {
+        if (bs[w]) {
+            return w * WORD_BITS + __builtin_ctzll(bs[w]);
+        }
+    }
+    return -1;
+}
+
+/**
+ * dst = a ∩ b
+ */
+inline void intersect(Word* dst, const Word* a, const Word* b, int words) {
+    for (int w = 0; w < words; w++) {
+        dst[w] = a[w] & b[w];
+    }
+}
+
+/**
+ * |a ∩ b| without materializing the intersection
+ */
+inline int intersect_count(const Word* a, const Word* b, int words) {
+    int c = 0;
+    for (int w = 0; w < words; w++) {
+        c += __builtin_popcountll(a[w] & b[w]);
+    }
+    return c;
+}
+
+/**
+ * Call f(i) for every set bit i in increasing order
+ */
+template<typename F>
+inline void for_each(const Word* bs, int words, F f) {
+    for (int w = 0; w < words; w++) {
+        Word bits = bs[w];
+        while (bits) {
+            int i = w * WORD_BITS + __builtin_ctzll(bits);
+            bits &= bits - 1;
+            f(i);
+        }
+    }
+}
+
+} // namespace bitset_ops
+
+/**
+ * Bitset adjacency matrix of the subgraph induced by a vertex list
+ *
+ * Vertices are relabeled to 0..k-1 in the order given, and row i holds
+ * N(vertices[i]) restricted to the list. Solvers that work on small
+ * subproblems (a vertex's later neighbors, a suffix of an ordering) build
+ * one of these once and then run all set operations as word operations.
+ *
+ * Space complexity: O(k² / 64) words
+ */
+class BitsetSubgraph {
+public:
+    using Word = bitset_ops::Word;
+
+    /**
+     * Build adjacency rows for the subgraph induced by vertices
+     *
+     * If core >= 0, only pairs with at least one endpoint among the first
+     * core vertices are filled in; edges among the remaining vertices are
+     * left out. Enumeration uses this for exclusion sets, whose mutual
+     * adjacency is never queried.
+     *
+     * @param g Input graph
+     * @param vertices Global vertex IDs; local ID i maps to vertices[i]
+     * @param core Number of leading vertices with complete rows (-1 = all)
+     *
+     * Time complexity: O(k²), or O(core * k) with a core
+     */
+    void build(const Graph& g, const std::vector<int>& vertices, int core = -1);
+
+    /**
+     * Number of vertices in the subgraph
+     */
+    int size() const { return k; }
+
+    /**
+     * Number of 64-bit words per row
+     */
+    int words() const { return nwords; }
+
+    /**
+     * Neighborhood of local vertex i as a bitset row
+     */
+    const Word* row(int i) const { return adj.data() + (size_t)i * nwords; }
+
+    /**
+     * Global vertex ID of local vertex i
+     */
+    int global_id(int i) const { return ids[i]; }
+
+private:
+    int k = 0;
+    int nwords = 0;
+    std::vector<int> ids;
+    std::vector<Word> adj;
+};
+
+#endif // BITSET_GRAPH_HPP
+
+
+void BitsetSubgraph::build(const Graph& g, const std::vector<int>& vertices, int core) {
+    ids = vertices;
+    k = vertices.size();
+    nwords = bitset_ops::num_words(k);
+    adj.assign((size_t)k * nwords, 0);
+
+    int full_rows = (core < 0) ? k : std::min(core, k);
+    for (int i = 0; i < full_rows; i++) {
+        Word* row_i = adj.data() + (size_t)i * nwords;
+        for (int j = i + 1; j < k; j++) {
+            if (g.has_edge(ids[i], ids[j])) {
+                bitset_ops::set_bit(row_i, j);
+                bitset_ops::set_bit(adj.data() + (size_t)j * nwords, i);
+            }
+        }
+    }
+}
@@ -25,8 +25,11 @@ class Graph;
  *   - Recurse with R∪{v}, P∩N(v), X∩N(v)
  *   - Move v from P to X
  * 
+ * The search runs on an explicit SearchStack rather than native recursion,
+ * so depth is bounded by heap memory instead of the thread stack.
+ * 
  * Time complexity: O(3^(n/3)) in worst case (exponential)
- * Space complexity: O(n) for recursion depth
+ * Space complexity: O(n) frames
  * 
  * This is the basic version without pivoting optimization
  */
@@ -39,170 +42,178 @@ public:
      */
     std::vector<int> find_maximum_clique(const Graph& g);
     
+    /**
+     * Stop after this many seconds and return the incumbent
+     * @param seconds Wall-clock limit (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Get number of nodes explored by the last search
+     */
+    long long get_nodes_explored() const { return nodes_explored; }
+    
+    /**
+     * Search-tree statistics of the last search (empty unless built with -DSEARCH_STATS)
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
+    /**
+     * Search node: R is the path of frame vertices from the root
+     */
+    struct Frame {
+        int vertex = -1;               // Vertex added to R at this node
+        std::unordered_set<int> P;     // Candidate set
+        std::unordered_set<int> X;     // Excluded set
+        std::vector<int> branches;     // Snapshot of P to branch on
+        size_t next = 0;
+        
+        void exclude(int v) {
+            P.erase(v);
+            X.insert(v);
+        }
+        
+    };
+    
     std::vector<int> max_clique;
+    SearchStack<Frame> stack;
+    double time_limit = 0.0;
+    bool stopped = false;
+    long long nodes_explored = 0;
+    SearchStatsRecorder recorder;
     
     /**
-     * Recursive Bron-Kerbosch procedure
-     * @param R Current clique
-     * @param P Candidate set
-     * @param X Excluded set
-     * @param g Input graph
+     * Bound and leaf checks for a freshly pushed frame
+     * @return false if the node is closed and should be popped
      */
-    void bron_kerbosch(std::unordered_set<int> R, 
-                      std::unordered_set<int> P,
-                      std::unordered_set<int> X, 
-                      const Graph& g);
+    bool enter();
     
     /**
-     * Compute intersection of set and vertex neighbors
-     * @param s Input set
-     * @param v Vertex
-     * @param g Graph
-     * @return s ∩ N(v)
+     * One step of Bron-Kerbosch on the top frame: branch on the next
+     * vertex of P, or pop when none are left
      */
-    std::unordered_set<int> intersect_with_neighbors(
-        const std::unordered_set<int>& s, int v, const Graph& g);
+    void step(const Graph& g);
     
     /**
-     * Find initial greedy clique for better lower bound
+     * Compute intersection of set and vertex neighbors
+     * @param s Input set
+     * @param v Vertex
      * @param g Graph
-     * @return Greedy clique
+     * @param out Receives s ∩ N(v)
      */
-    std::vector<int> find_greedy_clique(const Graph& g);
+    void intersect_with_neighbors(const std::unordered_set<int>& s, int v,
+                                  const Graph& g, std::unordered_set<int>& out);
 };
 
 #endif // BRON_KERBOSCH_HPP
 
 
 
-std::unordered_set<int> BronKerbosch::intersect_with_neighbors(
-    const std::unordered_set<int>& s, int v, const Graph& g) {
-    
-    std::unordered_set<int> result;
+void BronKerbosch::intersect_with_neighbors(const std::unordered_set<int>& s, int v,
+                                            const Graph& g, std::unordered_set<int>& out) {
+    out.clear();
     const auto& neighbors = g.get_neighbors(v);
     
     for (int u : s) {
         if (neighbors.find(u) != neighbors.end()) {
-            result.insert(u);
+            out.insert(u);
         }
     }
-    
-    return result;
 }
 
-std::vector<int> BronKerbosch::find_greedy_clique(const Graph& g) {
-    std::vector<int> clique;
-    int n = g.num_vertices();
-    
-    // Start with highest degree vertex
-    int best_v = -1;
-    int best_deg = -1;
-    for (int v = 0; v < n; v++) {
-        int deg = g.get_neighbors(v).size();
-        if (deg > best_deg) {
-            best_deg = deg;
-            best_v = v;
-        }
+bool BronKerbosch::enter() {
+    nodes_explored++;
+    
+    Frame& f = stack.back();
+    size_t r = stack.depth() - 1;  // |R|
+    recorder.node(r);
+    if (f.P.empty()) {
+        recorder.leaf();
     }
     
-    if (best_v == -1) return clique;
-    
-    clique.push_back(best_v);
-    
-    // Greedily add vertices that are connected to all current clique members
-    std::unordered_set<int> candidates(g.get_neighbors(best_v).begin(), 
-                                       g.get_neighbors(best_v).end());
+    // PRUNING: Upper bound check - if current + all remaining can't beat best, prune
+    if (r + f.P.size() <= max_clique.size()) {
+        if (!f.P.empty()) recorder.size_prune();
+        return false;  // Cannot find a larger clique in this branch
+    }
     
-    while (!candidates.empty()) {
-        // Pick candidate with highest degree in candidates
-        int next_v = -1;
-        int max_deg = -1;
-        
-        for (int v : candidates) {
-            int deg = 0;
-            const auto& neighbors = g.get_neighbors(v);
-            for (int u : candidates) {
-                if (neighbors.find(u) != neighbors.end()) deg++;
-            }
-            if (deg > max_deg) {
-                max_deg = deg;
-                next_v = v;
-            }
-        }
-        
-        if (next_v == -1) break;
-        
-        clique.push_back(next_v);
-        
-        // Update candidates: intersect with neighbors of next_v
-        std::unordered_set<int> new_candidates;
-        const auto& neighbors = g.get_neighbors(next_v);
-        for (int v : candidates) {
-            if (v != next_v && neighbors.find(v) != neighbors.end()) {
-                new_candidates.insert(v);
+    // Base case: if P and X are both empty, R is a maximal clique
+    if (f.P.empty() && f.X.empty()) {
+        if (r > max_clique.size()) {
+            max_clique.clear();
+            for (size_t d = 1; d < stack.depth(); d++) {
+                max_clique.push_back(stack[d].vertex);
             }
+            recorder.incumbent(r);
         }
-        candidates = new_candidates;
+        return false;
     }
     
-    return clique;
+    // Branch over a snapshot of P (since exclude() will modify P)
+    f.branches.assign(f.P.begin(), f.P.end());
+    f.next = 0;
+    return true;
 }
 
-void BronKerbosch::bron_kerbosch(std::unordered_set<int> R,
-                                 std::unordered_set<int> P,
-                                 std::unordered_set<int> X,
-                                 const Graph& g) {
-    // PRUNING: Upper bound check - if current + all remaining can't beat best, prune
-    if (R.size() + P.size() <= max_clique.size()) {
-        return;  // Cannot find a larger clique in this branch
-    }
-    
-    // Base case: if P and X are both empty, R is a maximal clique
-    if (P.empty() && X.empty()) {
-        if (R.size() > max_clique.size()) {
-            max_clique.assign(R.begin(), R.end());
-        }
+void BronKerbosch::step(const Graph& g) {
+    size_t d = stack.depth() - 1;
+    if (stack[d].next == stack[d].branches.size()) {
+        stack.pop();
         return;
     }
     
-    // Make a copy of P to iterate over (since we'll modify P)
-    std::unordered_set<int> P_copy = P;
+    int v = stack[d].branches[stack[d].next++];
     
-    // For each vertex in P
-    for (int v : P_copy) {
-        // Create new sets
-        std::unordered_set<int> R_new = R;
-        R_new.insert(v);
-        
-        std::unordered_set<int> P_new = intersect_with_neighbors(P, v, g);
-        std::unordered_set<int> X_new = intersect_with_neighbors(X, v, g);
-        
-        // Recurse
-        bron_kerbosch(R_new, P_new, X_new, g);
-        
-        // Move v from P to X
-        P.erase(v);
-        X.insert(v);
+    // Child: R∪{v}, P∩N(v), X∩N(v)
+    Frame& child = stack.push();
+    Frame& parent = stack[d];
+    child.vertex = v;
+    intersect_with_neighbors(parent.P, v, g, child.P);
+    intersect_with_neighbors(parent.X, v, g, child.X);
+    
+    // Move v from P to X
+    parent.exclude(v);
+    
+    if (!enter()) {
+        stack.pop();
     }
 }
 
 std::vector<int> BronKerbosch::find_maximum_clique(const Graph& g) {
-    // OPTIMIZATION: Seed with greedy clique for better initial lower bound
-    max_clique = find_greedy_clique(g);
-    
-    // Initialize sets
-    std::unordered_set<int> R;  // Current clique (empty initially)
-    std::unordered_set<int> P;  // Candidate vertices (all vertices initially)
-    std::unordered_set<int> X;  // Excluded vertices (empty initially)
+    SearchDeadline deadline;
+    deadline.start(time_limit);
+    stopped = false;
+    nodes_explored = 0;
+    recorder.start();
+    
+    // OPTIMIZATION: Seed with multi-start greedy clique for better initial lower bound
+    max_clique = GreedyClique::find_clique_multistart(g).clique;
+    recorder.incumbent(max_clique.size());
+    
+    // Root: R empty, P = all vertices, X empty
+    stack.clear();
+    Frame& root = stack.push();
+    root.vertex = -1;
+    root.P.clear();
+    root.X.clear();
     
     int n = g.num_vertices();
     for (int v = 0; v < n; v++) {
-        P.insert(v);
+        root.P.insert(v);
     }
     
     // Run algorithm
-    bron_kerbosch(R, P, X, g);
+    if (enter()) {
+        stopped = !stack.run_until([&](SearchStack<Frame>&) { step(g); }, deadline);
+    } else {
+        stack.clear();
+    }
     
     return max_clique;
 }
@@ -0,0 +1,182 @@
+// clique_arena.cpp - Compact deduplicated storage for collected cliques
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <numeric>
+#include <cstdint>
+
+#ifndef CLIQUE_ARENA_HPP
+#define CLIQUE_ARENA_HPP
+
+/**
+ * Arena of cliques for solvers that report more than one solution
+ *
+ * All cliques share one flat vertex array indexed by offsets, so storing
+ * many small cliques costs no per-clique heap allocation. Cliques are
+ * stored sorted, and a hash index rejects duplicates. An optional limit
+ * caps the number of stored cliques, which keeps memory bounded on graphs
+ * with huge numbers of co-optimal cliques.
+ *
+ * Space complexity: O(total vertices stored + number of cliques)
+ */
+class CliqueArena {
+public:
+    /**
+     * Constructor
+     * @param limit Maximum number of cliques kept (0 = unbounded)
+     */
+    CliqueArena(size_t limit = 0);
+
+    /**
+     * Insert a clique unless it is a duplicate or the arena is full
+     * @param clique Vertex IDs in any order
+     * @return true if the clique was stored
+     */
+    bool add(std::vector<int> clique);
+
+    /**
+     * Keep only the k largest cliques (ties keep insertion order)
+     * @param k Number of cliques to keep
+     */
+    void keep_largest(size_t k);
+
+    /**
+     * Remove all cliques
+     */
+    void clear();
+
+    /**
+     * Number of stored cliques
+     */
+    size_t size() const { return offsets.size() - 1; }
+
+    /**
+     * True when the limit has been reached
+     */
+    bool full() const { return limit > 0 && size() >= limit; }
+
+    /**
+     * Size of the smallest stored clique (0 if empty)
+     */
+    int min_clique_size() const;
+
+    /**
+     * Copy stored cliques out as vectors, largest first
+     */
+    std::vector<std::vector<int>> to_vectors() const;
+
+private:
+    size_t limit;
+    std::vector<int> vertices;        // All cliques, concatenated
+    std::vector<size_t> offsets;      // Clique i is vertices[offsets[i] .. offsets[i+1])
+    std::unordered_multimap<uint64_t, size_t> index;  // Hash -> clique number
+
+    static uint64_t hash(const std::vector<int>& clique);
+    bool contains(const std::vector<int>& clique, uint64_t h) const;
+    int clique_size(size_t i) const { return offsets[i + 1] - offsets[i]; }
+};
+
+#endif // CLIQUE_ARENA_HPP
+
+
+CliqueArena::CliqueArena(size_t limit) : limit(limit), offsets(1, 0) {}
+
+uint64_t CliqueArena::hash(const std::vector<int>& clique) {
+    // FNV-1a over the sorted vertex IDs
+    uint64_t h = 1469598103934665603ULL;
+    for (int v : clique) {
+        h ^= (uint32_t)v;
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+bool CliqueArena::contains(const std::vector<int>& clique, uint64_t h) const {
+    auto range = index.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        size_t i = it->second;
+        if (clique_size(i) == (int)clique.size() &&
+            std::equal(clique.begin(), clique.end(), vertices.begin() + offsets[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CliqueArena::add(std::vector<int> clique) {
+    if (full()) {
+        return false;
+    }
+
+    std::sort(clique.begin(), clique.end());
+    uint64_t h = hash(clique);
+    if (contains(clique, h)) {
+        return false;
+    }
+
+    index.insert({h, size()});
+    vertices.insert(vertices.end(), clique.begin(), clique.end());
+    offsets.push_back(vertices.size());
+    return true;
+}
+
+void CliqueArena::keep_largest(size_t k) {
+    if (size() <= k) {
+        return;
+    }
+
+    std::vector<size_t> order(size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return clique_size(a) > clique_size(b);
+    });
+    order.resize(k);
+    std::sort(order.begin(), order.end());
+
+    // Rebuild in place: kept cliques only move toward the front
+    std::vector<size_t> new_offsets(1, 0);
+    size_t write = 0;
+    for (size_t i : order) {
+        for (size_t j = offsets[i]; j < offsets[i + 1]; j++) {
+            vertices[write++] = vertices[j];
+        }
+        new_offsets.push_back(write);
+    }
+    vertices.resize(write);
+    offsets.swap(new_offsets);
+
+    index.clear();
+    std::vector<int> clique;
+    for (size_t i = 0; i < size(); i++) {
+        clique.assign(vertices.begin() + offsets[i], vertices.begin() + offsets[i + 1]);
+        index.insert({hash(clique), i});
+    }
+}
+
+void CliqueArena::clear() {
+    vertices.clear();
+    offsets.assign(1, 0);
+    index.clear();
+}
+
+int CliqueArena::min_clique_size() const {
+    if (size() == 0) return 0;
+    int smallest = clique_size(0);
+    for (size_t i = 1; i < size(); i++) {
+        smallest = std::min(smallest, clique_size(i));
+    }
+    return smallest;
+}
+
+std::vector<std::vector<int>> CliqueArena::to_vectors() const {
+    std::vector<std::vector<int>> result;
+    result.reserve(size());
+    for (size_t i = 0; i < size(); i++) {
+        result.emplace_back(vertices.begin() + offsets[i], vertices.begin() + offsets[i + 1]);
+    }
+    std::stable_sort(result.begin(), result.end(),
+                     [](const std::vector<int>& a, const std::vector<int>& b) {
+                         return a.size() > b.size();
+                     });
+    return result;
+}
@@ -0,0 +1,559 @@
+// clique_enumerator.cpp - Maximal clique enumeration with streaming output
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <memory>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#ifndef CLIQUE_ENUMERATOR_HPP
+#define CLIQUE_ENUMERATOR_HPP
+
+
+/**
+ * Buffered binary sink for enumerated cliques
+ *
+ * Each clique is written as a record of little-endian uint32 values:
+ *   size, v_1, ..., v_size
+ * Vertex IDs are the 0-indexed IDs assigned by Graph::load_from_snap.
+ * Records are staged in memory and written in large blocks, so output
+ * cost does not depend on clique count.
+ */
+class CliqueWriter {
+public:
+    /**
+     * Open output file
+     * @param filename Path to binary output file
+     * @param buffer_values Number of uint32 values staged before a write
+     * @throws runtime_error if file cannot be opened
+     */
+    CliqueWriter(const std::string& filename, size_t buffer_values = 1 << 20);
+
+    ~CliqueWriter();
+
+    /**
+     * Append one clique record
+     * @param clique Vector of vertex IDs
+     */
+    void write(const std::vector<int>& clique);
+
+    /**
+     * Write all staged records to the file
+     */
+    void flush();
+
+private:
+    std::ofstream out;
+    std::vector<uint32_t> buffer;
+    size_t capacity;
+};
+
+
+/**
+ * Maximal clique enumeration (Eppstein–Löffler–Strash)
+ *
+ * Algorithm:
+ * 1. Compute degeneracy ordering of vertices
+ * 2. For each vertex v in degeneracy order:
+ *    - P = neighbors of v after v, X = neighbors of v before v
+ *    - Relabel P ∪ X to 0..k-1 and build bitset rows for P × (P ∪ X)
+ *    - Run Tomita pivoting (pivot maximizes |P ∩ N(u)|) on word bitsets
+ * 3. Each maximal clique is reported exactly once, from its earliest
+ *    vertex in the ordering
+ *
+ * Cliques are streamed to a callback or a CliqueWriter as they are found
+ * and are never collected in memory. Cliques smaller than min_size are
+ * skipped, and branches that cannot reach min_size are pruned.
+ *
+ * Parallelism:
+ * - Workers take root vertices from the ordering, largest subproblem first
+ * - While another worker is idle, a branch with many candidates is pushed
+ *   onto the owner's deque as a task instead of being recursed into;
+ *   idle workers steal the oldest (largest) task from other deques
+ * - Each worker buffers cliques locally and flushes them to the callback
+ *   in batches under one lock, so callbacks are serialized but may run
+ *   on any worker thread, in no particular order
+ *
+ * Time complexity: O(d * n * 3^(d/3)) where d is degeneracy
+ * Space complexity: O(n + Δ² / 64) words per worker, Δ = maximum degree
+ *
+ * Reference: Eppstein, Löffler, Strash (2010) "Listing all maximal
+ *            cliques in sparse graphs in near-optimal time"
+ */
+class MaximalCliqueEnumerator {
+public:
+    using Callback = std::function<void(const std::vector<int>&)>;
+
+    /**
+     * Constructor
+     * @param min_size Smallest clique size to report
+     * @param num_threads Worker threads (0 = std::thread::hardware_concurrency())
+     */
+    MaximalCliqueEnumerator(int min_size = 1, int num_threads = 0);
+
+    /**
+     * Call on_clique once per maximal clique of size >= min_size
+     * The vector passed to the callback is only valid during the call.
+     * Calls are serialized, but may come from any worker thread.
+     * @param g Input graph
+     * @param on_clique Callback receiving vertex IDs of each clique
+     * @return Number of cliques reported
+     */
+    long long enumerate(const Graph& g, const Callback& on_clique);
+
+    /**
+     * Write every maximal clique of size >= min_size to a binary sink
+     * @param g Input graph
+     * @param writer Output sink
+     * @return Number of cliques written
+     */
+    long long enumerate(const Graph& g, CliqueWriter& writer);
+
+    /**
+     * Count maximal cliques of size >= min_size without reporting them
+     * @param g Input graph
+     * @return Number of maximal cliques
+     */
+    long long count(const Graph& g);
+
+    /**
+     * Size of the largest clique seen by the last run
+     */
+    int get_max_clique_size() const { return max_size; }
+
+private:
+    using Word = bitset_ops::Word;
+
+    // Split a branch only if it still has this many candidates
+    static constexpr int SPLIT_MIN_CANDIDATES = 16;
+    // Flush a worker's clique buffer once it holds this many values
+    static constexpr size_t BATCH_VALUES = 1 << 16;
+
+    /**
+     * Branch split off for another worker: search R with sets P, X
+     * inside a subgraph shared with the worker that created it
+     */
+    struct Task {
+        std::shared_ptr<const BitsetSubgraph> sub;
+        std::vector<int> R;
+        std::vector<Word> PX;  // P words followed by X words
+    };
+
+    /**
+     * Per-worker state
+     */
+    struct Worker {
+        std::shared_ptr<const BitsetSubgraph> sub;  // Subgraph being searched
+        std::vector<Word> levels;   // P and X bitsets for each search depth
+        std::vector<Word> branch;   // P \ N(pivot) for each search depth
+        std::vector<int> R;         // Current clique (global IDs)
+        std::vector<int> local;     // Scratch for building a root subproblem
+        std::vector<int> batch;     // Buffered cliques: size, v_1, ..., v_size
+        long long num_cliques = 0;
+        int max_size = 0;
+
+        std::deque<Task> tasks;     // Split branches, stolen from the front
+        std::mutex tasks_mutex;
+    };
+
+    int min_size;
+    int num_threads;
+    int max_size;
+    long long num_cliques;
+    const Callback* callback;  // nullptr in counting mode
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::mutex output_mutex;          // Serializes callback invocations
+    std::atomic<int> idle_workers;    // Workers currently looking for work
+    std::atomic<long long> pending;   // Roots and tasks queued or running
+
+    /**
+     * Run enumeration over all degeneracy subproblems
+     * @param g Input graph
+     * @param on_clique Callback, or nullptr to only count
+     */
+    long long run(const Graph& g, const Callback* on_clique);
+
+    /**
+     * Worker loop: own tasks, then new roots, then stolen tasks
+     */
+    void work(int id, const Graph& g,
+              const std::vector<int>& roots,
+              const std::vector<int>& ordering,
+              const std::vector<int>& position,
+              std::atomic<size_t>& next_root);
+
+    /**
+     * Build and search the subproblem rooted at ordering[i]
+     */
+    void solve_root(Worker& w, int i, const Graph& g,
+                    const std::vector<int>& ordering,
+                    const std::vector<int>& position);
+
+    /**
+     * Search a branch split off by another worker
+     */
+    void solve_task(Worker& w, Task& task);
+
+    /**
+     * Try to take a task from another worker's deque
+     */
+    bool steal(int id, Task& task);
+
+    /**
+     * Tomita pivoting recursion inside the worker's subgraph
+     * @param w Worker
+     * @param depth Index of P/X bitsets in w.levels
+     */
+    void expand(Worker& w, int depth);
+
+    /**
+     * Record w.R as a maximal clique
+     */
+    void report(Worker& w);
+
+    /**
+     * Pass a worker's buffered cliques to the callback
+     */
+    void flush(Worker& w);
+};
+
+#endif // CLIQUE_ENUMERATOR_HPP
+
+
+
+CliqueWriter::CliqueWriter(const std::string& filename, size_t buffer_values)
+    : out(filename, std::ios::binary), capacity(std::max<size_t>(buffer_values, 1)) {
+    if (!out.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    buffer.reserve(capacity);
+}
+
+CliqueWriter::~CliqueWriter() {
+    flush();
+}
+
+void CliqueWriter::write(const std::vector<int>& clique) {
+    if (buffer.size() + clique.size() + 1 > capacity) {
+        flush();
+    }
+    buffer.push_back(clique.size());
+    for (int v : clique) {
+        buffer.push_back(v);
+    }
+}
+
+void CliqueWriter::flush() {
+    if (!buffer.empty()) {
+        out.write(reinterpret_cast<const char*>(buffer.data()),
+                  buffer.size() * sizeof(uint32_t));
+        buffer.clear();
+    }
+    out.flush();
+}
+
+
+MaximalCliqueEnumerator::MaximalCliqueEnumerator(int min_size, int num_threads)
+    : min_size(std::max(min_size, 1)), num_threads(num_threads), max_size(0),
+      num_cliques(0), callback(nullptr), idle_workers(0), pending(0) {
+    if (this->num_threads <= 0) {
+        this->num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+void MaximalCliqueEnumerator::report(Worker& w) {
+    w.num_cliques++;
+    w.max_size = std::max(w.max_size, (int)w.R.size());
+    if (callback) {
+        w.batch.push_back(w.R.size());
+        w.batch.insert(w.batch.end(), w.R.begin(), w.R.end());
+        if (w.batch.size() >= BATCH_VALUES) {
+            flush(w);
+        }
+    }
+}
+
+void MaximalCliqueEnumerator::flush(Worker& w) {
+    if (w.batch.empty()) return;
+
+    std::lock_guard<std::mutex> lock(output_mutex);
+    std::vector<int> clique;
+    for (size_t i = 0; i < w.batch.size(); i += 1 + w.batch[i]) {
+        clique.assign(w.batch.begin() + i + 1, w.batch.begin() + i + 1 + w.batch[i]);
+        (*callback)(clique);
+    }
+    w.batch.clear();
+}
+
+void MaximalCliqueEnumerator::expand(Worker& w, int depth) {
+    const BitsetSubgraph& sub = *w.sub;
+    int words = sub.words();
+    Word* P = w.levels.data() + (size_t)depth * 2 * words;
+    Word* X = P + words;
+    Word* P_new = X + words;
+    Word* X_new = P_new + words;
+
+    if (bitset_ops::none(P, words)) {
+        if (bitset_ops::none(X, words) && (int)w.R.size() >= min_size) {
+            report(w);
+        }
+        return;
+    }
+
+    // PRUNING: R plus every candidate is still below min_size
+    if ((int)w.R.size() + bitset_ops::count(P, words) < min_size) {
+        return;
+    }
+
+    // Choose pivot from P ∪ X that maximizes |P ∩ N(pivot)|
+    int pivot = -1;
+    int max_intersection = -1;
+    auto consider = [&](int u) {
+        int c = bitset_ops::intersect_count(P, sub.row(u), words);
+        if (c > max_intersection) {
+            max_intersection = c;
+            pivot = u;
+        }
+    };
+    bitset_ops::for_each(P, words, consider);
+    bitset_ops::for_each(X, words, consider);
+
+    // Branch on P \ N(pivot)
+    Word* candidates = w.branch.data() + (size_t)depth * words;
+    const Word* pivot_row = sub.row(pivot);
+    for (int i = 0; i < words; i++) {
+        candidates[i] = P[i] & ~pivot_row[i];
+    }
+
+    bitset_ops::for_each(candidates, words, [&](int v) {
+        const Word* Nv = sub.row(v);
+        bitset_ops::intersect(P_new, P, Nv, words);
+        bitset_ops::intersect(X_new, X, Nv, words);
+
+        w.R.push_back(sub.global_id(v));
+
+        // Hand large branches to idle workers instead of recursing
+        if (idle_workers.load(std::memory_order_relaxed) > 0 &&
+            bitset_ops::count(P_new, words) >= SPLIT_MIN_CANDIDATES) {
+            Task task;
+            task.sub = w.sub;
+            task.R = w.R;
+            task.PX.assign(P_new, P_new + 2 * words);
+            pending++;
+            std::lock_guard<std::mutex> lock(w.tasks_mutex);
+            w.tasks.push_back(std::move(task));
+        } else {
+            expand(w, depth + 1);
+        }
+
+        w.R.pop_back();
+
+        // Move v from P to X
+        bitset_ops::reset_bit(P, v);
+        bitset_ops::set_bit(X, v);
+    });
+}
+
+void MaximalCliqueEnumerator::solve_root(Worker& w, int i, const Graph& g,
+                                         const std::vector<int>& ordering,
+                                         const std::vector<int>& position) {
+    int v = ordering[i];
+
+    // Local IDs: P = later neighbors first, then X = earlier neighbors
+    w.local.clear();
+    for (int u : g.get_neighbors(v)) {
+        if (position[u] > i) w.local.push_back(u);
+    }
+    int p = w.local.size();
+    for (int u : g.get_neighbors(v)) {
+        if (position[u] < i) w.local.push_back(u);
+    }
+
+    // A fresh subgraph per root: split tasks may still hold the old one
+    auto sub = std::make_shared<BitsetSubgraph>();
+    sub->build(g, w.local, p);
+    w.sub = sub;
+    int k = sub->size();
+    int words = sub->words();
+
+    // Each depth holds P, X; depth + 1 is written by the parent
+    w.levels.resize((size_t)(p + 2) * 2 * words);
+    w.branch.resize((size_t)(p + 1) * words);
+    std::fill(w.levels.begin(), w.levels.begin() + 2 * words, 0);
+    for (int j = 0; j < p; j++) {
+        bitset_ops::set_bit(w.levels.data(), j);
+    }
+    for (int j = p; j < k; j++) {
+        bitset_ops::set_bit(w.levels.data() + words, j);
+    }
+
+    w.R.assign(1, v);
+    expand(w, 0);
+}
+
+void MaximalCliqueEnumerator::solve_task(Worker& w, Task& task) {
+    w.sub = task.sub;
+    int words = w.sub->words();
+    int p = bitset_ops::count(task.PX.data(), words);
+
+    w.levels.resize((size_t)(p + 2) * 2 * words);
+    w.branch.resize((size_t)(p + 1) * words);
+    std::copy(task.PX.begin(), task.PX.end(), w.levels.begin());
+
+    w.R = std::move(task.R);
+    expand(w, 0);
+}
+
+bool MaximalCliqueEnumerator::steal(int id, Task& task) {
+    for (int j = 1; j < (int)workers.size(); j++) {
+        Worker& victim = *workers[(id + j) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.tasks_mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void MaximalCliqueEnumerator::work(int id, const Graph& g,
+                                   const std::vector<int>& roots,
+                                   const std::vector<int>& ordering,
+                                   const std::vector<int>& position,
+                                   std::atomic<size_t>& next_root) {
+    Worker& w = *workers[id];
+    Task task;
+    bool idle = false;
+
+    while (true) {
+        bool have_task = false;
+        {
+            std::lock_guard<std::mutex> lock(w.tasks_mutex);
+            if (!w.tasks.empty()) {
+                task = std::move(w.tasks.back());
+                w.tasks.pop_back();
+                have_task = true;
+            }
+        }
+        if (!have_task && next_root.load() < roots.size()) {
+            // Count the root as pending before claiming it, so no worker
+            // sees pending == 0 while a root is being picked up
+            pending++;
+            size_t r = next_root++;
+            if (r < roots.size()) {
+                if (idle) { idle = false; idle_workers--; }
+                solve_root(w, roots[r], g, ordering, position);
+                pending--;
+                continue;
+            }
+            pending--;
+        }
+        if (!have_task) {
+            have_task = steal(id, task);
+        }
+
+        if (have_task) {
+            if (idle) { idle = false; idle_workers--; }
+            solve_task(w, task);
+            pending--;
+            continue;
+        }
+
+        if (pending.load() == 0) {
+            break;
+        }
+        if (!idle) { idle = true; idle_workers++; }
+        std::this_thread::yield();
+    }
+
+    if (idle) idle_workers--;
+    flush(w);
+}
+
+long long MaximalCliqueEnumerator::run(const Graph& g, const Callback* on_clique) {
+    callback = on_clique;
+    num_cliques = 0;
+    max_size = 0;
+
+    int n = g.num_vertices();
+    std::vector<int> ordering = g.compute_degeneracy_ordering();
+    std::vector<int> position(n);
+    for (int i = 0; i < n; i++) {
+        position[ordering[i]] = i;
+    }
+
+    // Root subproblems by number of later neighbors, largest first
+    std::vector<std::pair<int, int>> sized_roots;
+    for (int i = 0; i < n; i++) {
+        int later = 0;
+        for (int u : g.get_neighbors(ordering[i])) {
+            if (position[u] > i) later++;
+        }
+        // PRUNING: v and all later neighbors are below min_size
+        if (1 + later >= min_size) {
+            sized_roots.push_back({later, i});
+        }
+    }
+    std::sort(sized_roots.begin(), sized_roots.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::vector<int> roots;
+    roots.reserve(sized_roots.size());
+    for (const auto& [later, i] : sized_roots) {
+        roots.push_back(i);
+    }
+
+    int threads = std::max(1, std::min<int>(num_threads, roots.size()));
+    workers.clear();
+    for (int t = 0; t < threads; t++) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    idle_workers = 0;
+    pending = 0;
+    std::atomic<size_t> next_root(0);
+
+    if (threads == 1) {
+        work(0, g, roots, ordering, position, next_root);
+    } else {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(&MaximalCliqueEnumerator::work, this, t, std::cref(g),
+                              std::cref(roots), std::cref(ordering), std::cref(position),
+                              std::ref(next_root));
+        }
+        for (auto& th : pool) {
+            th.join();
+        }
+    }
+
+    for (const auto& w : workers) {
+        num_cliques += w->num_cliques;
+        max_size = std::max(max_size, w->max_size);
+    }
+    workers.clear();
+
+    callback = nullptr;
+    return num_cliques;
+}
+
+long long MaximalCliqueEnumerator::enumerate(const Graph& g, const Callback& on_clique) {
+    return run(g, &on_clique);
+}
+
+long long MaximalCliqueEnumerator::enumerate(const Graph& g, CliqueWriter& writer) {
+    Callback sink = [&writer](const std::vector<int>& clique) { writer.write(clique); };
+    long long total = run(g, &sink);
+    writer.flush();
+    return total;
+}
+
+long long MaximalCliqueEnumerator::count(const Graph& g) {
+    return run(g, nullptr);
+}
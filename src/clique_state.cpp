@@ -0,0 +1,267 @@
+// clique_state.cpp - Incremental clique bookkeeping for local search heuristics
+#include <vector>
+#include <algorithm>
+
+#ifndef CLIQUE_STATE_HPP
+#define CLIQUE_STATE_HPP
+
+/**
+ * Set of vertex IDs with O(1) insert, erase and membership test
+ *
+ * Elements are stored densely, so a uniform random element is
+ * set[rand() % set.size()].
+ */
+class VertexSet {
+public:
+    /**
+     * Make the set empty over vertex IDs 0..n-1
+     */
+    void resize(int n) {
+        items.clear();
+        pos.assign(n, -1);
+    }
+
+    bool contains(int v) const { return pos[v] >= 0; }
+
+    void insert(int v) {
+        if (pos[v] >= 0) return;
+        pos[v] = items.size();
+        items.push_back(v);
+    }
+
+    void erase(int v) {
+        int i = pos[v];
+        if (i < 0) return;
+        int last = items.back();
+        items[i] = last;
+        pos[last] = i;
+        items.pop_back();
+        pos[v] = -1;
+    }
+
+    /**
+     * Remove all elements in O(size)
+     */
+    void clear() {
+        for (int v : items) pos[v] = -1;
+        items.clear();
+    }
+
+    int size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+    int operator[](int i) const { return items[i]; }
+    const std::vector<int>& elements() const { return items; }
+
+private:
+    std::vector<int> items;  // Elements in arbitrary order
+    std::vector<int> pos;    // Index of v in items, or -1
+};
+
+/**
+ * Clique maintained under local search moves, with tightness bookkeeping
+ *
+ * For every vertex v, conn[v] counts clique members adjacent to v, so v
+ * misses |C| - conn[v] of them. Two candidate sets are kept:
+ * - add:  non-members missing no member; adding one keeps a clique
+ * - swap: non-members missing exactly one member; swapping one in for
+ *         that member keeps a clique of the same size
+ *
+ * A move updates conn over the neighbors of the vertices it moves. The
+ * candidate sets are then rebuilt from the neighborhoods of the two
+ * lowest-degree members: every add candidate is adjacent to both, and
+ * every swap candidate to at least one. A move costs O(deg) rather than
+ * O(n · |C|), and the clique never needs revalidating. With fewer than
+ * two members the rebuild scans all vertices.
+ *
+ * GraphT needs num_vertices(), get_degree(v), has_edge(u, v) and an
+ * iterable get_neighbors(v). CliqueState runs on Graph; heuristics with
+ * their own (e.g. reduced CSR) graph instantiate BasicCliqueState on it.
+ *
+ * Space complexity: O(V)
+ */
+template<typename GraphT>
+class BasicCliqueState {
+public:
+    /**
+     * Reset to the given clique
+     * @param g Input graph (must outlive this state)
+     * @param clique Vertex IDs forming a clique
+     *
+     * Time complexity: O(V + sum of member degrees)
+     */
+    void assign(const GraphT& g, const std::vector<int>& clique);
+
+    /**
+     * Add v to the clique (v must be an add candidate)
+     */
+    void add(int v);
+
+    /**
+     * Remove member v from the clique
+     */
+    void remove(int v);
+
+    /**
+     * Remove several members, rebuilding the candidates once
+     *
+     * Time complexity: O(sum of their degrees) plus one rebuild
+     */
+    void remove(const std::vector<int>& vs);
+
+    /**
+     * Swap v into the clique for the one member it is not adjacent to
+     * (v must be a swap candidate)
+     * @return The member that was removed
+     */
+    int swap_in(int v);
+
+    /**
+     * The member that swap candidate v is not adjacent to
+     */
+    int missing_member(int v) const;
+
+    /**
+     * Number of members v is not adjacent to (v not a member)
+     */
+    int missing(int v) const { return size() - conn[v]; }
+
+    bool contains(int v) const { return members.contains(v); }
+    int size() const { return members.size(); }
+
+    const VertexSet& clique() const { return members; }
+    const VertexSet& add_candidates() const { return add_set; }
+    const VertexSet& swap_candidates() const { return swap_set; }
+
+private:
+    const GraphT* graph = nullptr;
+    VertexSet members;
+    VertexSet add_set;
+    VertexSet swap_set;
+    std::vector<int> conn;  // Members adjacent to each vertex
+
+    void insert_member(int v);
+    void erase_member(int v);
+    void rebuild_candidates();
+};
+
+using CliqueState = BasicCliqueState<Graph>;
+
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::assign(const GraphT& g, const std::vector<int>& clique) {
+    graph = &g;
+    int n = g.num_vertices();
+    members.resize(n);
+    add_set.resize(n);
+    swap_set.resize(n);
+    conn.assign(n, 0);
+
+    for (int v : clique) {
+        insert_member(v);
+    }
+    rebuild_candidates();
+}
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::insert_member(int v) {
+    members.insert(v);
+    for (int u : graph->get_neighbors(v)) {
+        conn[u]++;
+    }
+}
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::erase_member(int v) {
+    members.erase(v);
+    for (int u : graph->get_neighbors(v)) {
+        conn[u]--;
+    }
+}
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::add(int v) {
+    insert_member(v);
+    rebuild_candidates();
+}
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::remove(int v) {
+    erase_member(v);
+    rebuild_candidates();
+}
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::remove(const std::vector<int>& vs) {
+    for (int v : vs) {
+        erase_member(v);
+    }
+    rebuild_candidates();
+}
+
+template<typename GraphT>
+int BasicCliqueState<GraphT>::missing_member(int v) const {
+    for (int u : members.elements()) {
+        if (!graph->has_edge(u, v)) {
+            return u;
+        }
+    }
+    return -1;
+}
+
+template<typename GraphT>
+int BasicCliqueState<GraphT>::swap_in(int v) {
+    int out = missing_member(v);
+    erase_member(out);
+    insert_member(v);
+    rebuild_candidates();
+    return out;
+}
+
+template<typename GraphT>
+void BasicCliqueState<GraphT>::rebuild_candidates() {
+    add_set.clear();
+    swap_set.clear();
+    int k = size();
+
+    auto classify = [&](int u) {
+        if (members.contains(u)) return;
+        int m = k - conn[u];
+        if (m == 0) {
+            add_set.insert(u);
+        } else if (m == 1) {
+            swap_set.insert(u);
+        }
+    };
+
+    if (k < 2) {
+        for (int u = 0; u < graph->num_vertices(); u++) {
+            classify(u);
+        }
+        return;
+    }
+
+    // Two lowest-degree members keep the scan small
+    int w1 = -1, w2 = -1;
+    for (int u : members.elements()) {
+        if (w1 < 0 || graph->get_degree(u) < graph->get_degree(w1)) {
+            w2 = w1;
+            w1 = u;
+        } else if (w2 < 0 || graph->get_degree(u) < graph->get_degree(w2)) {
+            w2 = u;
+        }
+    }
+
+    // Add candidates and swap candidates adjacent to w1
+    for (int u : graph->get_neighbors(w1)) {
+        classify(u);
+    }
+
+    // Remaining swap candidates miss w1 and nothing else
+    for (int u : graph->get_neighbors(w2)) {
+        if (!members.contains(u) && !graph->has_edge(u, w1) && k - conn[u] == 1) {
+            swap_set.insert(u);
+        }
+    }
+}
+
+#endif // CLIQUE_STATE_HPP
@@ -0,0 +1,220 @@
+// core_scheduler.cpp - CPU topology discovery and core allocation for concurrent benchmark jobs
+#include <vector>
+#include <string>
+#include <tuple>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <fstream>
+#include <algorithm>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#ifndef CORE_SCHEDULER_HPP
+#define CORE_SCHEDULER_HPP
+
+/**
+ * One logical CPU and the physical core it belongs to
+ */
+struct CpuSlot {
+    int cpu;
+    int package;  // Socket
+    int core;     // Physical core within the socket
+};
+
+/**
+ * Logical CPUs this process may run on, grouped by physical core
+ */
+class CpuTopology {
+public:
+    /**
+     * Read the affinity mask and the sysfs topology
+     *
+     * If the topology cannot be read, every CPU counts as its own
+     * physical core; without an affinity mask, CPUs 0..n-1 are assumed.
+     */
+    static CpuTopology detect();
+
+    const std::vector<CpuSlot>& cpus() const { return slots; }
+    int physical_cores() const;
+
+    /**
+     * CPUs to place jobs on, first hyperthread of every core first
+     *
+     * Filling CPUs in this order spreads jobs over physical cores before
+     * any two share one. With isolated only the first hyperthread of each
+     * core is returned, so its siblings stay idle.
+     */
+    std::vector<int> job_cpus(bool isolated) const;
+
+private:
+    std::vector<CpuSlot> slots;  // Sorted by package, core, cpu
+};
+
+/**
+ * Hands out disjoint sets of CPUs to concurrent jobs
+ *
+ * Requests are served first come, first served, so a job that needs
+ * several CPUs is not starved by single-CPU jobs behind it.
+ *
+ * Usage:
+ *   CoreAllocator cores(topology.job_cpus(false));
+ *   std::vector<int> mine = cores.acquire(4);
+ *   ...
+ *   cores.release(mine);
+ */
+class CoreAllocator {
+public:
+    explicit CoreAllocator(const std::vector<int>& cpus);
+
+    int size() const { return (int)cpus.size(); }
+
+    /**
+     * Wait until n CPUs are free and take them (n is clamped to size())
+     */
+    std::vector<int> acquire(int n);
+
+    void release(const std::vector<int>& taken);
+
+private:
+    std::vector<int> cpus;
+    std::vector<bool> busy;
+    int free_count;
+    unsigned long long next_ticket = 0;
+    unsigned long long serving = 0;
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+/**
+ * Restrict the calling thread, and the threads and processes it starts
+ * afterwards, to the given CPUs
+ * @return False if the affinity could not be set (or on non-Linux builds)
+ */
+bool pin_to_cpus(const std::vector<int>& cpus);
+
+#endif // CORE_SCHEDULER_HPP
+
+
+static bool read_topology_id(int cpu, const char* field, int& value) {
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + field);
+    int v;
+    if (!(file >> v)) return false;
+    value = v;
+    return true;
+}
+
+CpuTopology CpuTopology::detect() {
+    CpuTopology topology;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (!CPU_ISSET(cpu, &set)) continue;
+            CpuSlot slot = {cpu, 0, cpu};
+            int package, core;
+            if (read_topology_id(cpu, "physical_package_id", package) &&
+                read_topology_id(cpu, "core_id", core)) {
+                slot.package = package;
+                slot.core = core;
+            }
+            topology.slots.push_back(slot);
+        }
+    }
+#endif
+    if (topology.slots.empty()) {
+        int n = std::max(1u, std::thread::hardware_concurrency());
+        for (int cpu = 0; cpu < n; cpu++) {
+            topology.slots.push_back({cpu, 0, cpu});
+        }
+    }
+    std::sort(topology.slots.begin(), topology.slots.end(), [](const CpuSlot& a, const CpuSlot& b) {
+        return std::tie(a.package, a.core, a.cpu) < std::tie(b.package, b.core, b.cpu);
+    });
+    return topology;
+}
+
+int CpuTopology::physical_cores() const {
+    int count = 0;
+    for (size_t i = 0; i < slots.size(); i++) {
+        if (i == 0 || slots[i].package != slots[i - 1].package || slots[i].core != slots[i - 1].core) {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::vector<int> CpuTopology::job_cpus(bool isolated) const {
+    // Rank of each CPU among its core's hyperthreads: 0 for the first, 1 for its sibling...
+    std::vector<std::pair<int, int>> ranked;
+    int rank = 0;
+    for (size_t i = 0; i < slots.size(); i++) {
+        bool same_core = i > 0 && slots[i].package == slots[i - 1].package &&
+                         slots[i].core == slots[i - 1].core;
+        rank = same_core ? rank + 1 : 0;
+        if (isolated && rank > 0) continue;
+        ranked.push_back({rank, (int)i});
+    }
+    std::stable_sort(ranked.begin(), ranked.end(),
+                     [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                         return a.first < b.first;
+                     });
+
+    std::vector<int> result;
+    for (const auto& r : ranked) {
+        result.push_back(slots[r.second].cpu);
+    }
+    return result;
+}
+
+CoreAllocator::CoreAllocator(const std::vector<int>& cpus)
+    : cpus(cpus), busy(cpus.size(), false), free_count((int)cpus.size()) {}
+
+std::vector<int> CoreAllocator::acquire(int n) {
+    n = std::max(1, std::min(n, size()));
+    std::unique_lock<std::mutex> lock(mutex);
+    unsigned long long ticket = next_ticket++;
+    changed.wait(lock, [&]() { return serving == ticket && free_count >= n; });
+
+    std::vector<int> taken;
+    for (size_t i = 0; i < cpus.size() && (int)taken.size() < n; i++) {
+        if (busy[i]) continue;
+        busy[i] = true;
+        taken.push_back(cpus[i]);
+    }
+    free_count -= n;
+    serving++;
+    changed.notify_all();
+    return taken;
+}
+
+void CoreAllocator::release(const std::vector<int>& taken) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int cpu : taken) {
+            auto it = std::find(cpus.begin(), cpus.end(), cpu);
+            if (it != cpus.end() && busy[it - cpus.begin()]) {
+                busy[it - cpus.begin()] = false;
+                free_count++;
+            }
+        }
+    }
+    changed.notify_all();
+}
+
+bool pin_to_cpus(const std::vector<int>& cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+    }
+    return !cpus.empty() && sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
@@ -36,10 +36,38 @@ public:
      */
     std::vector<int> find_maximum_clique(const Graph& g);
     
+    /**
+     * Stop after this many seconds and return the incumbent
+     * @param seconds Wall-clock limit (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Get number of nodes explored by the last search
+     */
+    long long get_nodes_explored() const { return nodes_explored; }
+    
+    /**
+     * Search-tree statistics of the last search (empty unless built with -DSEARCH_STATS)
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
+    static constexpr long long DEADLINE_INTERVAL = 4096;  // Nodes between clock reads
+    
     std::vector<int> max_clique;
     std::vector<std::bitset<MAX_VERTICES>> neighbors;
     int n;
+    double time_limit = 0.0;
+    SearchDeadline deadline;
+    bool stopped = false;
+    long long nodes_explored = 0;
+    SearchStatsRecorder recorder;
     
     /**
      * Optimized Bron-Kerbosch with bitsets
@@ -114,10 +142,25 @@ inline int CPUOptimized::choose_pivot(const std::bitset<MAX_VERTICES>& P,
 inline void CPUOptimized::optimized_bk(std::bitset<MAX_VERTICES> R,
                                        std::bitset<MAX_VERTICES> P,
                                        std::bitset<MAX_VERTICES> X) {
+    nodes_explored++;
+    if (nodes_explored % DEADLINE_INTERVAL == 0 && deadline.expired()) {
+        stopped = true;
+    }
+    if (stopped) {
+        return;
+    }
+    
     // OPTIMIZATION: Prune if current + remaining cannot beat best
     int current_size = R.count();
     int remaining_size = P.count();
+    recorder.node(current_size);
+    if (P.none()) {
+        recorder.leaf();
+    }
     if (current_size + remaining_size <= (int)max_clique.size()) {
+        if (remaining_size > 0) {
+            recorder.size_prune();
+        }
         return;  // Cannot find a larger clique in this branch
     }
     
@@ -125,6 +168,7 @@ inline void CPUOptimized::optimized_bk(std::bitset<MAX_VERTICES> R,
     if (P.none() && X.none()) {
         if (current_size > (int)max_clique.size()) {
             max_clique = bitset_to_vector(R);
+            recorder.incumbent(current_size);
         }
         return;
     }
@@ -146,6 +190,7 @@ inline void CPUOptimized::optimized_bk(std::bitset<MAX_VERTICES> R,
         
         // OPTIMIZATION: Check if this branch can improve best
         if (current_size + 1 + remaining_size <= (int)max_clique.size()) {
+            recorder.size_prune();
             break;  // No point continuing
         }
         
@@ -158,6 +203,9 @@ inline void CPUOptimized::optimized_bk(std::bitset<MAX_VERTICES> R,
         
         // Recurse
         optimized_bk(R_new, P_new, X_new);
+        if (stopped) {
+            return;
+        }
         
         // Move v from P to X
         P.reset(v);
@@ -174,6 +222,10 @@ std::vector<int> CPUOptimized::find_maximum_clique(const Graph& g) {
                                std::to_string(MAX_VERTICES) + " vertices)");
     }
     
+    deadline.start(time_limit);
+    stopped = false;
+    nodes_explored = 0;
+    recorder.start();
     max_clique.clear();
     neighbors.clear();
     neighbors.resize(n);
@@ -0,0 +1,383 @@
+// dataset_loader.cpp - Dataset discovery, cached graph statistics and background graph loading
+#include <vector>
+#include <string>
+#include <memory>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifndef DATASET_LOADER_HPP
+#define DATASET_LOADER_HPP
+
+/**
+ * Summary statistics of a graph, printed and written with every result
+ */
+struct GraphStats {
+    int num_vertices;
+    int num_edges;
+    double density;
+    int max_degree;
+    double avg_degree;
+    int degeneracy;
+
+    void compute(const Graph& g);
+};
+
+/**
+ * One graph file to benchmark
+ */
+struct DatasetEntry {
+    std::string path;
+    std::string name;      // File name, used in output file names and rows
+    std::string category;  // Manifest column, or the name of the parent directory
+};
+
+/**
+ * All *.txt files below dir, sorted by path
+ * @param dir Directory searched recursively
+ * @return Datasets, categorized by their parent directory
+ */
+std::vector<DatasetEntry> find_datasets(const std::string& dir);
+
+/**
+ * Read a manifest: one "path [category]" per line, '#' starts a comment
+ *
+ * Relative paths are resolved against the manifest's directory.
+ * @param filename Manifest file
+ * @param entries Output: datasets in manifest order
+ * @param error Output: reason on failure
+ * @return False if the manifest cannot be read or names a missing file
+ */
+bool read_manifest(const std::string& filename, std::vector<DatasetEntry>& entries,
+                   std::string& error);
+
+/**
+ * GraphStats persisted across runs, keyed by path, file size and mtime
+ *
+ * Stats are looked up and stored from loader threads. A file that
+ * changed since it was cached is simply recomputed and overwritten.
+ */
+class GraphStatsCache {
+public:
+    /**
+     * @param filename Cache file (created by save() if missing)
+     */
+    explicit GraphStatsCache(const std::string& filename);
+
+    /**
+     * Cached stats for path, if the file is unchanged since they were stored
+     */
+    bool lookup(const std::string& path, GraphStats& stats);
+
+    void store(const std::string& path, const GraphStats& stats);
+
+    /**
+     * Write all entries back to the cache file
+     */
+    bool save();
+
+private:
+    struct Entry {
+        long long size;
+        long long mtime;
+        GraphStats stats;
+    };
+
+    std::string filename;
+    std::map<std::string, Entry> entries;
+    std::mutex mutex;
+
+    static bool file_key(const std::string& path, long long& size, long long& mtime);
+};
+
+/**
+ * A graph loaded by DatasetLoader, or the error that prevented it
+ */
+struct LoadedDataset {
+    DatasetEntry entry;
+    Graph graph;
+    GraphStats stats;
+    bool stats_cached = false;
+    double load_seconds = 0.0;  // Parse and stats time on the loader thread
+    std::string error;
+};
+
+/**
+ * Loads graphs ahead of the consumer on a small thread pool
+ *
+ * next() returns datasets in entry order. Up to lookahead datasets past
+ * the one being consumed are parsed and have their stats computed in the
+ * background, so graph loading overlaps the previous dataset's solvers
+ * without holding the whole sweep in memory. Loader threads run at a
+ * lower scheduling priority so they disturb the timed solvers as little
+ * as possible. With threads = 0 each graph is loaded inside next().
+ *
+ * Usage:
+ *   DatasetLoader loader(entries, 2, 1, &cache);
+ *   while (std::unique_ptr<LoadedDataset> d = loader.next()) { ... }
+ */
+class DatasetLoader {
+public:
+    /**
+     * @param entries Datasets in the order next() returns them
+     * @param threads Loader threads (0 = load on demand in next())
+     * @param lookahead Datasets loaded ahead of the consumer (at least 1)
+     * @param cache Stats cache (nullptr = always compute)
+     */
+    DatasetLoader(const std::vector<DatasetEntry>& entries, int threads, int lookahead,
+                  GraphStatsCache* cache);
+    ~DatasetLoader();
+
+    DatasetLoader(const DatasetLoader&) = delete;
+    DatasetLoader& operator=(const DatasetLoader&) = delete;
+
+    /**
+     * The next dataset in order, waiting for it if needed (nullptr when done)
+     */
+    std::unique_ptr<LoadedDataset> next();
+
+private:
+    std::vector<DatasetEntry> entries;
+    std::vector<std::unique_ptr<LoadedDataset>> slots;
+    GraphStatsCache* cache;
+    int lookahead;
+    size_t next_to_load = 0;
+    size_t next_to_return = 0;
+    bool stopping = false;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::thread> pool;
+
+    std::unique_ptr<LoadedDataset> load(const DatasetEntry& entry);
+    void worker();
+};
+
+#endif // DATASET_LOADER_HPP
+
+
+void GraphStats::compute(const Graph& g) {
+    num_vertices = g.num_vertices();
+    num_edges = g.num_edges();
+    density = g.get_density();
+
+    // Compute max and avg degree
+    max_degree = 0;
+    long long total_degree = 0;
+    for (int v = 0; v < num_vertices; v++) {
+        int deg = g.get_degree(v);
+        max_degree = std::max(max_degree, deg);
+        total_degree += deg;
+    }
+    avg_degree = num_vertices > 0 ? (double)total_degree / num_vertices : 0.0;
+
+    // Compute degeneracy
+    degeneracy = g.get_degeneracy();
+}
+
+std::vector<DatasetEntry> find_datasets(const std::string& dir) {
+    namespace fs = std::filesystem;
+    std::vector<DatasetEntry> entries;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file() || it->path().extension() != ".txt") continue;
+        DatasetEntry entry;
+        entry.path = it->path().string();
+        entry.name = it->path().filename().string();
+        entry.category = it->path().parent_path().filename().string();
+        entries.push_back(entry);
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const DatasetEntry& a, const DatasetEntry& b) { return a.path < b.path; });
+    return entries;
+}
+
+bool read_manifest(const std::string& filename, std::vector<DatasetEntry>& entries,
+                   std::string& error) {
+    namespace fs = std::filesystem;
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        error = "Cannot open manifest: " + filename;
+        return false;
+    }
+
+    fs::path base = fs::path(filename).parent_path();
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line)) {
+        line_number++;
+        line = line.substr(0, line.find('#'));
+        std::istringstream iss(line);
+        std::string path;
+        if (!(iss >> path)) continue;
+
+        fs::path p(path);
+        if (p.is_relative()) p = base / p;
+        if (!fs::is_regular_file(p)) {
+            error = filename + ":" + std::to_string(line_number) + ": no such file " + p.string();
+            return false;
+        }
+
+        DatasetEntry entry;
+        entry.path = p.string();
+        entry.name = p.filename().string();
+        if (!(iss >> entry.category)) {
+            entry.category = p.parent_path().filename().string();
+        }
+        entries.push_back(entry);
+    }
+    return true;
+}
+
+GraphStatsCache::GraphStatsCache(const std::string& filename) : filename(filename) {
+    // One entry per line: path, size, mtime, then the GraphStats fields, tab separated
+    std::ifstream file(filename);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream iss(line);
+        std::string path;
+        Entry e;
+        GraphStats& s = e.stats;
+        if (std::getline(iss, path, '\t') &&
+            iss >> e.size >> e.mtime >> s.num_vertices >> s.num_edges >> s.density
+                >> s.max_degree >> s.avg_degree >> s.degeneracy) {
+            entries[path] = e;
+        }
+    }
+}
+
+bool GraphStatsCache::file_key(const std::string& path, long long& size, long long& mtime) {
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) return false;
+    size = st.st_size;
+    mtime = st.st_mtime;
+    return true;
+}
+
+bool GraphStatsCache::lookup(const std::string& path, GraphStats& stats) {
+    long long size, mtime;
+    if (!file_key(path, size, mtime)) return false;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entries.find(path);
+    if (it == entries.end() || it->second.size != size || it->second.mtime != mtime) {
+        return false;
+    }
+    stats = it->second.stats;
+    return true;
+}
+
+void GraphStatsCache::store(const std::string& path, const GraphStats& stats) {
+    long long size, mtime;
+    if (!file_key(path, size, mtime)) return;
+    std::lock_guard<std::mutex> lock(mutex);
+    entries[path] = {size, mtime, stats};
+}
+
+bool GraphStatsCache::save() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ofstream file(filename);
+    if (!file.is_open()) return false;
+    file.precision(17);
+    for (const auto& [path, e] : entries) {
+        const GraphStats& s = e.stats;
+        file << path << '\t' << e.size << '\t' << e.mtime << '\t'
+             << s.num_vertices << '\t' << s.num_edges << '\t' << s.density << '\t'
+             << s.max_degree << '\t' << s.avg_degree << '\t' << s.degeneracy << '\n';
+    }
+    return (bool)file;
+}
+
+DatasetLoader::DatasetLoader(const std::vector<DatasetEntry>& entries, int threads, int lookahead,
+                             GraphStatsCache* cache)
+    : entries(entries), slots(entries.size()), cache(cache),
+      lookahead(std::max(lookahead, 1)) {
+    threads = std::min<int>(threads, entries.size());
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back(&DatasetLoader::worker, this);
+    }
+}
+
+DatasetLoader::~DatasetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    for (auto& th : pool) {
+        th.join();
+    }
+}
+
+std::unique_ptr<LoadedDataset> DatasetLoader::load(const DatasetEntry& entry) {
+    auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<LoadedDataset> d(new LoadedDataset());
+    d->entry = entry;
+    try {
+        d->graph = Graph::load_from_snap(entry.path, false);
+        d->stats_cached = cache && cache->lookup(entry.path, d->stats);
+        if (!d->stats_cached) {
+            d->stats.compute(d->graph);
+            if (cache) cache->store(entry.path, d->stats);
+        }
+    } catch (const std::bad_alloc&) {
+        d->error = "Out of memory";
+    } catch (const std::exception& e) {
+        d->error = e.what();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    d->load_seconds = elapsed.count();
+    return d;
+}
+
+void DatasetLoader::worker() {
+    // Parsing overlaps a solver's run; keep its heap counts to the solver
+    AllocationTracker::untrack_this_thread();
+#ifdef __linux__
+    // Linux applies a thread ID's nice value to that thread only
+    setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), 10);
+#endif
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        changed.wait(lock, [this]() {
+            return stopping || next_to_load >= entries.size() ||
+                   next_to_load < next_to_return + lookahead;
+        });
+        if (stopping || next_to_load >= entries.size()) return;
+
+        size_t i = next_to_load++;
+        lock.unlock();
+        std::unique_ptr<LoadedDataset> d = load(entries[i]);
+        lock.lock();
+        slots[i] = std::move(d);
+        changed.notify_all();
+    }
+}
+
+std::unique_ptr<LoadedDataset> DatasetLoader::next() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (next_to_return >= entries.size()) return nullptr;
+    size_t i = next_to_return++;
+
+    if (pool.empty()) {
+        next_to_load = next_to_return;
+        lock.unlock();
+        return load(entries[i]);
+    }
+
+    // Consuming i lets the workers start one dataset further ahead
+    changed.notify_all();
+    changed.wait(lock, [this, i]() { return slots[i] != nullptr; });
+    return std::move(slots[i]);
+}
@@ -2,6 +2,9 @@
 #include <vector>
 #include <unordered_set>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 #ifndef DEGENERACY_BK_HPP
 #define DEGENERACY_BK_HPP
@@ -15,13 +18,22 @@
  * Algorithm:
  * 1. Compute degeneracy ordering of vertices
  * 2. For each vertex v in degeneracy order:
- *    - Let P = neighbors of v that come after v in ordering
- *    - Let X = neighbors of v that come before v in ordering
- *    - Run Tomita (BK with pivoting) on {v} ∪ P with exclusion set X
- * 3. This ensures each maximal clique is found exactly once
+ *    - Let P = neighbors of v that come after v in ordering (|P| <= d)
+ *    - Relabel P to 0..k-1 and build a k×k bitset adjacency matrix once
+ *    - Run coloring branch-and-bound on {v} ∪ P inside that matrix
+ * 3. Every clique is searched only from its earliest vertex in the
+ *    ordering, so earlier neighbors (X) never need to be revisited
+ * 
+ * This is the Eppstein–Löffler–Strash layout: each subproblem is small
+ * and dense, so set operations become cache-resident word operations
+ * instead of hash probes into the global graph.
+ * 
+ * The per-vertex subproblems are independent, so they are scheduled on a
+ * thread pool, largest first. Workers share the incumbent size through an
+ * atomic for pruning and copy improved cliques under a mutex.
  * 
  * Time complexity: O(d * 3^(d/3)) where d is degeneracy
- * Space complexity: O(n)
+ * Space complexity: O(n + d² / 64) words per worker
  * 
  * Optimal for sparse graphs (where d << n)
  * Reference: Eppstein, Löffler, Strash (2010)
@@ -29,287 +41,273 @@
 class DegeneracyBK {
 public:
     /**
-     * Find maximum clique using degeneracy ordering + Tomita
+     * Constructor
+     * @param num_threads Worker threads for per-vertex subproblems
+     *                    (0 = std::thread::hardware_concurrency())
+     */
+    DegeneracyBK(int num_threads = 0);
+    
+    /**
+     * Find maximum clique using degeneracy ordering + local bitset B&B
      * @param g Input graph
      * @return Vector of vertex IDs forming maximum clique
      */
     std::vector<int> find_maximum_clique(const Graph& g);
     
+    /**
+     * Stop after this many seconds and return the incumbent
+     * @param seconds Wall-clock limit (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Get number of nodes explored by the last search (all workers)
+     */
+    long long get_nodes_explored() const { return nodes_explored; }
+    
+    /**
+     * Search-tree statistics of the last search, merged over all workers
+     * (empty unless built with -DSEARCH_STATS)
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
-    std::vector<int> max_clique;
+    using Word = bitset_ops::Word;
+    
+    static constexpr long long DEADLINE_INTERVAL = 4096;  // Nodes between clock reads
     
     /**
-     * Tomita recursive procedure with pivoting
-     * @param R Current clique
-     * @param P Candidate set
-     * @param X Excluded set
-     * @param g Graph
+     * Per-worker scratch space, reused across subproblems
      */
-    void tomita_with_pivot(std::unordered_set<int> R,
-                          std::unordered_set<int> P,
-                          std::unordered_set<int> X,
-                          const Graph& g);
+    struct Workspace {
+        BitsetSubgraph sub;         // Adjacency among v's later neighbors
+        std::vector<Word> levels;   // Candidate bitset for each search depth
+        std::vector<int> order;     // Coloring order for each search depth
+        std::vector<int> colour;    // Color of order[i] for each search depth
+        std::vector<Word> uncoloured;
+        std::vector<Word> colour_class;
+        std::vector<int> R;         // Current clique (global IDs)
+        std::vector<int> later;
+        long long nodes = 0;
+        SearchStatsRecorder recorder;
+    };
+    
+    int num_threads;
+    std::vector<int> max_clique;
+    std::atomic<int> best_size;  // |max_clique|, read lock-free for pruning
+    std::mutex clique_mutex;     // Guards writes to max_clique
+    
+    double time_limit = 0.0;
+    SearchDeadline deadline;
+    std::atomic<bool> stopping{false};  // Set by the first worker to see the deadline pass
+    bool stopped = false;
+    long long nodes_explored = 0;
+    SearchStatsRecorder recorder;  // Outer loop, then merged worker recorders
     
     /**
-     * Choose pivot vertex
-     * @param P Candidate set
-     * @param X Excluded set
+     * Solve the subproblem rooted at one vertex of the ordering
+     * @param i Position of the vertex in the degeneracy ordering
+     * @param ordering Degeneracy ordering
+     * @param position Position of each vertex in the ordering
      * @param g Graph
-     * @return Pivot vertex
+     * @param ws Worker scratch space
      */
-    int choose_pivot(const std::unordered_set<int>& P,
-                    const std::unordered_set<int>& X,
-                    const Graph& g);
+    void solve_subproblem(int i,
+                          const std::vector<int>& ordering,
+                          const std::vector<int>& position,
+                          const Graph& g,
+                          Workspace& ws);
     
     /**
-     * Compute intersection of set and vertex neighbors
-     * @param s Input set
-     * @param v Vertex
-     * @param g Graph
-     * @return s ∩ N(v)
+     * Replace incumbent with R if R is larger
+     * @param R Candidate clique
+     * @return True if R became the incumbent
      */
-    std::unordered_set<int> intersect_with_neighbors(
-        const std::unordered_set<int>& s, int v, const Graph& g);
+    bool update_best(const std::vector<int>& R);
     
     /**
-     * Compute chromatic number upper bound using greedy coloring
-     * @param P Set of vertices to color
-     * @param g Graph
-     * @return Chromatic number (upper bound)
+     * Greedy sequential coloring of a local candidate set
+     * Writes vertices in color-class order and their colors (1-based)
+     * @param ws Worker scratch space
+     * @param depth Search depth whose candidate set is colored
+     * @return Number of candidates
      */
-    int compute_coloring_bound(const std::unordered_set<int>& P, const Graph& g);
+    int colour_sort(Workspace& ws, int depth);
     
     /**
-     * Find initial greedy clique for better lower bound
-     * @param g Graph
-     * @return Greedy clique
+     * Coloring branch-and-bound inside the local subgraph
+     * @param ws Worker scratch space
+     * @param depth Index of candidate bitset in ws.levels
      */
-    std::vector<int> find_greedy_clique(const Graph& g);
+    void expand(Workspace& ws, int depth);
 };
 
 #endif // DEGENERACY_BK_HPP
 
 
-std::unordered_set<int> DegeneracyBK::intersect_with_neighbors(
-    const std::unordered_set<int>& s, int v, const Graph& g) {
-    
-    std::unordered_set<int> result;
-    const auto& neighbors = g.get_neighbors(v);
-    
-    for (int u : s) {
-        if (neighbors.find(u) != neighbors.end()) {
-            result.insert(u);
-        }
+DegeneracyBK::DegeneracyBK(int num_threads)
+    : num_threads(num_threads), best_size(0) {
+    if (this->num_threads <= 0) {
+        this->num_threads = std::max(1u, std::thread::hardware_concurrency());
     }
-    
-    return result;
 }
 
-int DegeneracyBK::compute_coloring_bound(const std::unordered_set<int>& P, 
-                                         const Graph& g) {
-    if (P.empty()) return 0;
-    
-    std::unordered_map<int, int> colors;
-    int max_color = 0;
-    
-    // Order vertices by degree in P (descending)
-    std::vector<int> vertices(P.begin(), P.end());
-    std::sort(vertices.begin(), vertices.end(), 
-              [&P, &g](int u, int v) {
-                  const auto& nu = g.get_neighbors(u);
-                  const auto& nv = g.get_neighbors(v);
-                  int deg_u = 0, deg_v = 0;
-                  for (int w : P) {
-                      if (nu.find(w) != nu.end()) deg_u++;
-                      if (nv.find(w) != nv.end()) deg_v++;
-                  }
-                  return deg_u > deg_v;
-              });
-    
-    // Greedy sequential coloring
-    for (int v : vertices) {
-        std::vector<bool> used_colors(P.size() + 1, false);
+bool DegeneracyBK::update_best(const std::vector<int>& R) {
+    std::lock_guard<std::mutex> lock(clique_mutex);
+    if (R.size() > max_clique.size()) {
+        max_clique = R;
+        best_size.store(max_clique.size(), std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+int DegeneracyBK::colour_sort(Workspace& ws, int depth) {
+    int k = ws.sub.size();
+    int words = ws.sub.words();
+    const Word* P = ws.levels.data() + (size_t)depth * words;
+    int* order = ws.order.data() + (size_t)depth * k;
+    int* colour = ws.colour.data() + (size_t)depth * k;
+    Word* uncoloured = ws.uncoloured.data();
+    Word* Q = ws.colour_class.data();
+    
+    std::copy(P, P + words, uncoloured);
+    int colour_class = 0;
+    int m = 0;
+    
+    while (!bitset_ops::none(uncoloured, words)) {
+        colour_class++;
+        std::copy(uncoloured, uncoloured + words, Q);
         
-        const auto& neighbors = g.get_neighbors(v);
-        for (int u : P) {
-            if (u != v && neighbors.find(u) != neighbors.end()) {
-                if (colors.find(u) != colors.end()) {
-                    used_colors[colors[u]] = true;
-                }
+        // Fill one color class with pairwise non-adjacent vertices
+        int v;
+        while ((v = bitset_ops::first(Q, words)) != -1) {
+            bitset_ops::reset_bit(uncoloured, v);
+            bitset_ops::reset_bit(Q, v);
+            
+            const Word* Nv = ws.sub.row(v);
+            for (int w = 0; w < words; w++) {
+                Q[w] &= ~Nv[w];
             }
+            
+            order[m] = v;
+            colour[m] = colour_class;
+            m++;
         }
-        
-        int color = 0;
-        while (used_colors[color]) color++;
-        
-        colors[v] = color;
-        max_color = std::max(max_color, color);
     }
     
-    return max_color + 1;  // Chromatic number
+    return m;
 }
 
-std::vector<int> DegeneracyBK::find_greedy_clique(const Graph& g) {
-    std::vector<int> clique;
-    int n = g.num_vertices();
-    
-    // Start with highest degree vertex
-    int best_v = -1;
-    int best_deg = -1;
-    for (int v = 0; v < n; v++) {
-        int deg = g.get_neighbors(v).size();
-        if (deg > best_deg) {
-            best_deg = deg;
-            best_v = v;
-        }
+void DegeneracyBK::expand(Workspace& ws, int depth) {
+    if (++ws.nodes % DEADLINE_INTERVAL == 0 && deadline.expired()) {
+        stopping = true;
     }
-    
-    if (best_v == -1) return clique;
-    
-    clique.push_back(best_v);
-    
-    // Greedily add vertices that are connected to all current clique members
-    std::unordered_set<int> candidates(g.get_neighbors(best_v).begin(), 
-                                       g.get_neighbors(best_v).end());
-    
-    while (!candidates.empty()) {
-        // Pick candidate with highest degree in candidates
-        int next_v = -1;
-        int max_deg = -1;
-        
-        for (int v : candidates) {
-            int deg = 0;
-            const auto& neighbors = g.get_neighbors(v);
-            for (int u : candidates) {
-                if (neighbors.find(u) != neighbors.end()) deg++;
-            }
-            if (deg > max_deg) {
-                max_deg = deg;
-                next_v = v;
-            }
+    if (stopping.load(std::memory_order_relaxed)) {
+        return;
+    }
+    ws.recorder.node(ws.R.size());
+    
+    int k = ws.sub.size();
+    int words = ws.sub.words();
+    Word* P = ws.levels.data() + (size_t)depth * words;
+    Word* next = P + words;
+    
+    int m = colour_sort(ws, depth);
+    const int* order = ws.order.data() + (size_t)depth * k;
+    const int* colour = ws.colour.data() + (size_t)depth * k;
+    
+    // Process vertices in reverse color order (best first)
+    for (int i = m - 1; i >= 0; i--) {
+        // Color bound: R plus one vertex per remaining color class
+        if ((int)ws.R.size() + colour[i] <= best_size.load(std::memory_order_relaxed)) {
+            ws.recorder.coloring_prune();
+            return;
         }
         
-        if (next_v == -1) break;
+        int v = order[i];
+        bitset_ops::intersect(next, P, ws.sub.row(v), words);
+        ws.R.push_back(ws.sub.global_id(v));
         
-        clique.push_back(next_v);
-        
-        // Update candidates: intersect with neighbors of next_v
-        std::unordered_set<int> new_candidates;
-        const auto& neighbors = g.get_neighbors(next_v);
-        for (int v : candidates) {
-            if (v != next_v && neighbors.find(v) != neighbors.end()) {
-                new_candidates.insert(v);
+        if (bitset_ops::none(next, words)) {
+            ws.recorder.node(ws.R.size());
+            ws.recorder.leaf();
+            if ((int)ws.R.size() > best_size.load(std::memory_order_relaxed) &&
+                update_best(ws.R)) {
+                ws.recorder.incumbent(ws.R.size());
+            }
+        } else {
+            expand(ws, depth + 1);
+            if (stopping.load(std::memory_order_relaxed)) {
+                return;
             }
         }
-        candidates = new_candidates;
+        
+        ws.R.pop_back();
+        bitset_ops::reset_bit(P, v);
     }
-    
-    return clique;
 }
 
-int DegeneracyBK::choose_pivot(const std::unordered_set<int>& P,
-                               const std::unordered_set<int>& X,
-                               const Graph& g) {
-    int best_pivot = -1;
-    int max_intersection = -1;
-    
-    // Check vertices in P
-    for (int v : P) {
-        auto intersection = intersect_with_neighbors(P, v, g);
-        if ((int)intersection.size() > max_intersection) {
-            max_intersection = intersection.size();
-            best_pivot = v;
-        }
-    }
-    
-    // Check vertices in X
-    for (int v : X) {
-        auto intersection = intersect_with_neighbors(P, v, g);
-        if ((int)intersection.size() > max_intersection) {
-            max_intersection = intersection.size();
-            best_pivot = v;
+void DegeneracyBK::solve_subproblem(int i,
+                                    const std::vector<int>& ordering,
+                                    const std::vector<int>& position,
+                                    const Graph& g,
+                                    Workspace& ws) {
+    int v = ordering[i];
+    
+    // P = neighbors of v that come after v in ordering
+    ws.later.clear();
+    for (int u : g.get_neighbors(v)) {
+        if (position[u] > i) {
+            ws.later.push_back(u);
         }
     }
     
-    return best_pivot;
-}
-
-void DegeneracyBK::tomita_with_pivot(std::unordered_set<int> R,
-                                     std::unordered_set<int> P,
-                                     std::unordered_set<int> X,
-                                     const Graph& g) {
-    // OPTIMIZATION 1: Color-based upper bound pruning
-    int coloring_bound = compute_coloring_bound(P, g);
-    if (R.size() + coloring_bound <= max_clique.size()) {
-        return;  // Chromatic number provides tight upper bound
-    }
-    
-    // OPTIMIZATION 2: Simple upper bound (fallback)
-    if (R.size() + P.size() <= max_clique.size()) {
-        return;  // Cannot find a larger clique in this branch
-    }
-    
-    // Base case
-    if (P.empty() && X.empty()) {
-        if (R.size() > max_clique.size()) {
-            max_clique.assign(R.begin(), R.end());
-        }
+    // Incumbent may have grown since this subproblem was scheduled
+    if (1 + (int)ws.later.size() <= best_size.load(std::memory_order_relaxed)) {
+        ws.recorder.size_prune();
         return;
     }
     
-    // Choose pivot
-    int pivot = choose_pivot(P, X, g);
-    
-    // Compute candidates: P \ N(pivot)
-    std::unordered_set<int> candidates;
-    if (pivot != -1) {
-        const auto& pivot_neighbors = g.get_neighbors(pivot);
-        for (int v : P) {
-            if (pivot_neighbors.find(v) == pivot_neighbors.end()) {
-                candidates.insert(v);
-            }
-        }
-    } else {
-        candidates = P;
+    // Higher degree first gives the greedy coloring larger early classes
+    std::sort(ws.later.begin(), ws.later.end(), [&g](int a, int b) {
+        return g.get_degree(a) > g.get_degree(b);
+    });
+    
+    // Relabel P to 0..k-1 and build its bitset adjacency once
+    ws.sub.build(g, ws.later);
+    int k = ws.sub.size();
+    int words = ws.sub.words();
+    
+    ws.levels.assign((size_t)(k + 1) * words, 0);
+    ws.order.resize((size_t)(k + 1) * k);
+    ws.colour.resize((size_t)(k + 1) * k);
+    ws.uncoloured.resize(words);
+    ws.colour_class.resize(words);
+    for (int j = 0; j < k; j++) {
+        bitset_ops::set_bit(ws.levels.data(), j);
     }
     
-    // OPTIMIZATION 3: Order candidates by degree (descending) for better pruning
-    std::vector<int> candidates_ordered(candidates.begin(), candidates.end());
-    std::sort(candidates_ordered.begin(), candidates_ordered.end(),
-              [&g, &P](int u, int v) {
-                  const auto& nu = g.get_neighbors(u);
-                  const auto& nv = g.get_neighbors(v);
-                  int deg_u = 0, deg_v = 0;
-                  for (int w : P) {
-                      if (nu.find(w) != nu.end()) deg_u++;
-                      if (nv.find(w) != nv.end()) deg_v++;
-                  }
-                  return deg_u > deg_v;
-              });
-    
-    // Recurse on candidates (ordered)
-    for (int v : candidates_ordered) {
-        // OPTIMIZATION 4: Early termination check
-        if (R.size() + 1 + P.size() <= max_clique.size()) {
-            break;  // No point continuing
-        }
-        
-        std::unordered_set<int> R_new = R;
-        R_new.insert(v);
-        
-        std::unordered_set<int> P_new = intersect_with_neighbors(P, v, g);
-        std::unordered_set<int> X_new = intersect_with_neighbors(X, v, g);
-        
-        tomita_with_pivot(R_new, P_new, X_new, g);
-        
-        P.erase(v);
-        X.insert(v);
-    }
+    // R = {v}
+    ws.R.assign(1, v);
+    expand(ws, 0);
 }
 
 std::vector<int> DegeneracyBK::find_maximum_clique(const Graph& g) {
-    // OPTIMIZATION: Seed with greedy clique for better initial lower bound
-    max_clique = find_greedy_clique(g);
+    deadline.start(time_limit);
+    stopping = false;
+    nodes_explored = 0;
+    recorder.start();
+    
+    // OPTIMIZATION: Seed with multi-start greedy clique for better initial lower bound
+    max_clique = GreedyClique::find_clique_multistart(g, true, num_threads).clique;
+    best_size.store(max_clique.size());
+    recorder.incumbent(max_clique.size());
     
     // Compute degeneracy ordering
     std::vector<int> ordering = g.compute_degeneracy_ordering();
@@ -320,44 +318,56 @@ std::vector<int> DegeneracyBK::find_maximum_clique(const Graph& g) {
         position[ordering[i]] = i;
     }
     
-    // Process vertices in degeneracy order
+    // One subproblem per vertex: (number of later neighbors, position)
+    std::vector<std::pair<int, int>> subproblems;
     for (size_t i = 0; i < ordering.size(); i++) {
-        int v = ordering[i];
-        
-        // OPTIMIZATION: Early termination if vertex + later neighbors can't beat best
-        const auto& neighbors = g.get_neighbors(v);
         int later_neighbors = 0;
-        for (int u : neighbors) {
+        for (int u : g.get_neighbors(ordering[i])) {
             if (position[u] > (int)i) later_neighbors++;
         }
         
+        // OPTIMIZATION: Skip vertices whose later neighbors can't beat best
         if (1 + later_neighbors <= (int)max_clique.size()) {
-            continue;  // Skip this vertex, cannot improve
+            recorder.size_prune();
+            continue;
         }
-        
-        // R = {v}
-        std::unordered_set<int> R;
-        R.insert(v);
-        
-        // P = neighbors of v that come after v in ordering
-        std::unordered_set<int> P;
-        for (int u : neighbors) {
-            if (position[u] > (int)i) {
-                P.insert(u);
+        subproblems.push_back({later_neighbors, (int)i});
+    }
+    
+    // Largest subproblems first, so the pool doesn't end on a long tail
+    std::sort(subproblems.begin(), subproblems.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    
+    std::atomic<size_t> next_subproblem(0);
+    auto worker = [&]() {
+        Workspace ws;
+        ws.recorder.start(recorder);
+        for (size_t t = next_subproblem++; t < subproblems.size(); t = next_subproblem++) {
+            if (stopping.load(std::memory_order_relaxed) || deadline.expired()) {
+                stopping = true;
+                break;
             }
+            solve_subproblem(subproblems[t].second, ordering, position, g, ws);
         }
         
-        // X = neighbors of v that come before v in ordering
-        std::unordered_set<int> X;
-        for (int u : neighbors) {
-            if (position[u] < (int)i) {
-                X.insert(u);
-            }
+        std::lock_guard<std::mutex> lock(clique_mutex);
+        nodes_explored += ws.nodes;
+        recorder.merge(ws.recorder);
+    };
+    
+    int threads = std::min<int>(num_threads, subproblems.size());
+    if (threads <= 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+        for (auto& th : pool) {
+            th.join();
         }
-        
-        // Run Tomita with pivoting
-        tomita_with_pivot(R, P, X, g);
     }
     
+    stopped = stopping;
     return max_clique;
 }
@@ -0,0 +1,304 @@
+// dynamic_local_search.cpp - Dynamic Local Search (DLS-MC) heuristic
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+
+#ifndef DYNAMIC_LOCAL_SEARCH_HPP
+#define DYNAMIC_LOCAL_SEARCH_HPP
+
+/**
+ * Dynamic Local Search for the maximum clique problem (DLS-MC)
+ *
+ * Unlike the memoryless heuristics, DLS-MC penalizes vertices that keep
+ * showing up in local optima, steering later phases to other regions.
+ *
+ * Algorithm:
+ * 1. Start from a single random vertex
+ * 2. Iterative improvement: while some vertex is adjacent to every
+ *    member, add the one with the lowest penalty
+ * 3. Plateau search: while no vertex can be added, swap in the vertex
+ *    with the lowest penalty that misses exactly one member. A vertex
+ *    removed during the plateau is not swapped back in, and the plateau
+ *    ends once no member of the clique it started from is left.
+ *    If a swap opens an add move, go back to step 2.
+ * 4. At the local optimum, increase the penalty of every member. Every
+ *    penalty_delay optima, decrease all nonzero penalties by one.
+ * 5. Perturb: with penalty_delay > 1, restart from the last vertex added;
+ *    otherwise add a random vertex and drop the members it misses
+ * 6. Stop at the step budget, time budget or target size
+ *
+ * Ties between equal penalties are broken at random. Add and swap
+ * candidates come from a CliqueState, so a step costs O(deg + candidates).
+ * A perturbation can leave a one-vertex clique whose swap candidates are
+ * all its non-neighbours, so it costs O(V).
+ *
+ * Time complexity: O(max_steps * (Δ + candidates) + optima * V), Δ = maximum degree
+ * Space complexity: O(V)
+ *
+ * Parameters:
+ * - penalty_delay: Optima between penalty decreases (1 = no penalties;
+ *   larger values suit graphs like brock with misleading hubs)
+ * - max_steps: Add and swap moves before stopping
+ * - time_limit: Wall-clock budget in seconds (0 = none)
+ * - target_size: Stop once a clique this large is found (0 = none)
+ *
+ * Reference: Pullan, Hoos (2006) "Dynamic Local Search for the Maximum
+ *            Clique Problem"
+ */
+class DynamicLocalSearch {
+public:
+    /**
+     * Constructor with configurable parameters
+     * @param penalty_delay Local optima between penalty decreases
+     * @param max_steps Maximum add and swap moves
+     * @param time_limit Wall-clock budget in seconds (0 = none)
+     * @param target_size Stop once a clique of this size is found (0 = none)
+     * @param seed Random seed for reproducibility (0 for random)
+     */
+    DynamicLocalSearch(int penalty_delay = 2, long long max_steps = 100000,
+                       double time_limit = 0.0, int target_size = 0,
+                       unsigned int seed = 0);
+
+    /**
+     * Find maximum clique using dynamic local search
+     * @param g Input graph
+     * @return Vector of vertex IDs forming the best clique found
+     */
+    std::vector<int> find_clique(const Graph& g);
+
+private:
+    // Steps between clock reads when a time limit is set
+    static constexpr int CLOCK_INTERVAL = 1024;
+
+    int penalty_delay;
+    long long max_steps;
+    double time_limit;
+    int target_size;
+    std::mt19937 rng;
+
+    // Per-run state
+    CliqueState state;
+    std::vector<int> penalty;
+    VertexSet penalized;             // Vertices with nonzero penalty
+    std::vector<long long> removed;  // Plateau in which each vertex was dropped
+    std::vector<char> in_start;      // Member of the clique the plateau started from
+    std::vector<int> best;
+    long long steps;
+    long long plateaus;
+    int last_added;
+
+    /**
+     * Lowest-penalty vertex of set accepted by allow (-1 if none)
+     */
+    template<typename Allow>
+    int select_min_penalty(const VertexSet& set, Allow allow);
+
+    void add(int v);
+
+    /**
+     * Add vertices until no add candidate is left
+     */
+    void expand();
+
+    /**
+     * Swap at the current size until an add move appears or the
+     * plateau is exhausted
+     * @return true if an add candidate is available
+     */
+    bool plateau_search();
+
+    /**
+     * Penalize the members of the current local optimum
+     * @param optimum Number of optima reached so far
+     */
+    void update_penalties(long long optimum);
+
+    /**
+     * Move away from the current local optimum
+     */
+    void perturb(const Graph& g);
+};
+
+#endif // DYNAMIC_LOCAL_SEARCH_HPP
+
+
+DynamicLocalSearch::DynamicLocalSearch(int penalty_delay, long long max_steps,
+                                       double time_limit, int target_size,
+                                       unsigned int seed)
+    : penalty_delay(std::max(penalty_delay, 1)), max_steps(max_steps),
+      time_limit(time_limit), target_size(target_size), steps(0), plateaus(0),
+      last_added(-1) {
+    if (seed == 0) {
+        std::random_device rd;
+        rng.seed(rd());
+    } else {
+        rng.seed(seed);
+    }
+}
+
+template<typename Allow>
+int DynamicLocalSearch::select_min_penalty(const VertexSet& set, Allow allow) {
+    int chosen = -1;
+    int ties = 0;
+    for (int v : set.elements()) {
+        if (!allow(v)) continue;
+        if (chosen < 0 || penalty[v] < penalty[chosen]) {
+            chosen = v;
+            ties = 1;
+        } else if (penalty[v] == penalty[chosen]) {
+            // Reservoir sampling: uniform among equal penalties
+            ties++;
+            if (std::uniform_int_distribution<int>(0, ties - 1)(rng) == 0) {
+                chosen = v;
+            }
+        }
+    }
+    return chosen;
+}
+
+void DynamicLocalSearch::add(int v) {
+    state.add(v);
+    last_added = v;
+    steps++;
+    if (state.size() > (int)best.size()) {
+        best = state.clique().elements();
+    }
+}
+
+void DynamicLocalSearch::expand() {
+    while (!state.add_candidates().empty() && steps < max_steps) {
+        add(select_min_penalty(state.add_candidates(), [](int) { return true; }));
+    }
+}
+
+bool DynamicLocalSearch::plateau_search() {
+    long long plateau = plateaus++;
+
+    // Remember the clique the plateau started from
+    std::vector<int> start_members = state.clique().elements();
+    for (int v : start_members) {
+        in_start[v] = 1;
+    }
+    int overlap = start_members.size();
+
+    while (state.add_candidates().empty() && overlap > 0 && steps < max_steps) {
+        int v = select_min_penalty(state.swap_candidates(),
+                                   [&](int u) { return removed[u] != plateau; });
+        if (v < 0) break;
+
+        int out = state.swap_in(v);
+        last_added = v;
+        removed[out] = plateau;
+        steps++;
+        if (in_start[out]) {
+            in_start[out] = 0;
+            overlap--;
+        }
+    }
+
+    for (int v : start_members) {
+        in_start[v] = 0;
+    }
+    return !state.add_candidates().empty();
+}
+
+void DynamicLocalSearch::update_penalties(long long optimum) {
+    for (int v : state.clique().elements()) {
+        penalty[v]++;
+        penalized.insert(v);
+    }
+
+    if (optimum % penalty_delay == 0) {
+        // Iterate a copy: erase reorders the set
+        std::vector<int> decay = penalized.elements();
+        for (int v : decay) {
+            if (--penalty[v] == 0) {
+                penalized.erase(v);
+            }
+        }
+    }
+}
+
+void DynamicLocalSearch::perturb(const Graph& g) {
+    if (penalty_delay > 1) {
+        // Restart from the most recently added vertex, touching only the
+        // neighbourhoods of the members that leave
+        std::vector<int> drop;
+        for (int u : state.clique().elements()) {
+            if (u != last_added) {
+                drop.push_back(u);
+            }
+        }
+        state.remove(drop);
+        if (!state.contains(last_added)) {
+            state.add(last_added);
+        }
+        steps++;
+        return;
+    }
+
+    // Add a random vertex, dropping the members it is not adjacent to
+    std::uniform_int_distribution<int> vertex_dist(0, g.num_vertices() - 1);
+    int v;
+    do {
+        v = vertex_dist(rng);
+    } while (state.contains(v));
+
+    std::vector<int> drop;
+    for (int u : state.clique().elements()) {
+        if (!g.has_edge(u, v)) {
+            drop.push_back(u);
+        }
+    }
+    state.remove(drop);
+    add(v);
+}
+
+std::vector<int> DynamicLocalSearch::find_clique(const Graph& g) {
+    int n = g.num_vertices();
+    best.clear();
+    if (n == 0) return best;
+
+    penalty.assign(n, 0);
+    penalized.resize(n);
+    removed.assign(n, -1);
+    in_start.assign(n, 0);
+    steps = 0;
+    plateaus = 0;
+
+    auto start_time = std::chrono::steady_clock::now();
+    auto out_of_time = [&]() {
+        if (time_limit <= 0.0) return false;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        return elapsed.count() >= time_limit;
+    };
+
+    // Start from a single random vertex
+    std::uniform_int_distribution<int> vertex_dist(0, n - 1);
+    last_added = vertex_dist(rng);
+    state.assign(g, {last_added});
+    best = state.clique().elements();
+
+    long long optimum = 0;
+    long long next_clock = CLOCK_INTERVAL;
+    while (steps < max_steps) {
+        if (target_size > 0 && (int)best.size() >= target_size) break;
+        if ((int)best.size() == n) break;
+        if (steps >= next_clock) {
+            if (out_of_time()) break;
+            next_clock = steps + CLOCK_INTERVAL;
+        }
+
+        // Improve and walk plateaus until neither finds an add move
+        do {
+            expand();
+        } while (plateau_search() && steps < max_steps);
+
+        optimum++;
+        update_penalties(optimum);
+        perturb(g);
+    }
+
+    return best;
+}
@@ -40,12 +40,13 @@ public:
      * Automatically converts to undirected graph (adds both directions)
      * 
      * @param filename Path to edge list file
+     * @param verbose Print the vertex and edge counts once loaded
      * @return Graph object
      * @throws runtime_error if file cannot be opened
      * 
      * Time complexity: O(V + E)
      */
-    static Graph load_from_snap(const std::string& filename);
+    static Graph load_from_snap(const std::string& filename, bool verbose = true);
     
     /**
      * Add undirected edge between vertices u and v
@@ -106,6 +107,9 @@ public:
      * 1. Repeatedly remove vertex of minimum degree
      * 2. Order of removal is degeneracy ordering
      * 
+     * Minimum-degree vertices are kept in degree buckets
+     * (Batagelj–Zaversnik), so no step scans all vertices.
+     * 
      * @return Vector of vertex IDs in degeneracy order
      * 
      * Time complexity: O(V + E)
@@ -120,6 +124,25 @@ public:
      */
     int get_degeneracy() const;
     
+    /**
+     * Compute core number of every vertex
+     * core[v] = largest k such that v belongs to a subgraph of minimum
+     * degree k. A clique of size s only contains vertices with core ≥ s-1.
+     * @return Vector of core numbers indexed by vertex ID
+     * 
+     * Time complexity: O(V + E)
+     */
+    std::vector<int> compute_core_numbers() const;
+    
+    /**
+     * Compute the degeneracy ordering and core numbers in one peel
+     * @param ordering Output: vertices in degeneracy order
+     * @param core Output: core number of each vertex
+     * 
+     * Time complexity: O(V + E)
+     */
+    void peel(std::vector<int>& ordering, std::vector<int>& core) const;
+    
     /**
      * Get density of graph (2*E / (V*(V-1)))
      * @return Density value between 0 and 1
@@ -147,7 +170,7 @@ Graph::Graph(int n) : n(n), m(0) {
     adj_matrix.resize(n, std::vector<bool>(n, false));
 }
 
-Graph Graph::load_from_snap(const std::string& filename) {
+Graph Graph::load_from_snap(const std::string& filename, bool verbose) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         throw std::runtime_error("Cannot open file: " + filename);
@@ -220,8 +243,10 @@ Graph Graph::load_from_snap(const std::string& filename) {
         }
     }
     
-    std::cout << "Loaded graph: " << g.num_vertices() << " vertices, " 
-              << g.num_edges() << " edges" << std::endl;
+    if (verbose) {
+        std::cout << "Loaded graph: " << g.num_vertices() << " vertices, " 
+                  << g.num_edges() << " edges" << std::endl;
+    }
     
     return g;
 }
@@ -270,83 +295,87 @@ int Graph::get_degree(int v) const {
     return adj_list[v].size();
 }
 
-std::vector<int> Graph::compute_degeneracy_ordering() const {
-    std::vector<int> ordering;
-    ordering.reserve(n);
+void Graph::peel(std::vector<int>& ordering, std::vector<int>& core) const {
+    ordering.assign(n, 0);
+    core.assign(n, 0);
     
-    std::vector<int> degrees(n);
-    std::vector<bool> removed(n, false);
+    int max_degree = 0;
+    for (int v = 0; v < n; v++) {
+        core[v] = adj_list[v].size();
+        max_degree = std::max(max_degree, core[v]);
+    }
     
-    // Initialize degrees
-    for (int i = 0; i < n; i++) {
-        degrees[i] = adj_list[i].size();
+    // Bucket sort vertices by degree: bin[d] = start of degree-d block
+    std::vector<int> bin(max_degree + 1, 0);
+    for (int v = 0; v < n; v++) {
+        bin[core[v]]++;
+    }
+    int start = 0;
+    for (int d = 0; d <= max_degree; d++) {
+        int count = bin[d];
+        bin[d] = start;
+        start += count;
     }
     
-    // Repeatedly remove vertex with minimum degree
-    for (int iter = 0; iter < n; iter++) {
-        // Find vertex with minimum degree that hasn't been removed
-        int min_degree = n + 1;
-        int min_vertex = -1;
-        
-        for (int v = 0; v < n; v++) {
-            if (!removed[v] && degrees[v] < min_degree) {
-                min_degree = degrees[v];
-                min_vertex = v;
-            }
-        }
-        
-        // Add to ordering and mark as removed
-        ordering.push_back(min_vertex);
-        removed[min_vertex] = true;
-        
-        // Update degrees of neighbors
-        for (int neighbor : adj_list[min_vertex]) {
-            if (!removed[neighbor]) {
-                degrees[neighbor]--;
+    std::vector<int> pos(n);
+    for (int v = 0; v < n; v++) {
+        pos[v] = bin[core[v]]++;
+        ordering[pos[v]] = v;
+    }
+    for (int d = max_degree; d > 0; d--) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+    
+    // Remove vertices front to back; each removal moves higher-degree
+    // neighbors one bucket down by swapping them to their block start
+    for (int i = 0; i < n; i++) {
+        int v = ordering[i];
+        for (int u : adj_list[v]) {
+            if (core[u] > core[v]) {
+                int du = core[u];
+                int pu = pos[u];
+                int pw = bin[du];
+                int w = ordering[pw];
+                if (u != w) {
+                    ordering[pu] = w;
+                    ordering[pw] = u;
+                    pos[u] = pw;
+                    pos[w] = pu;
+                }
+                bin[du]++;
+                core[u]--;
             }
         }
     }
-    
+}
+
+std::vector<int> Graph::compute_degeneracy_ordering() const {
+    std::vector<int> ordering;
+    std::vector<int> core;
+    peel(ordering, core);
     return ordering;
 }
 
 int Graph::get_degeneracy() const {
-    std::vector<int> degrees(n);
-    std::vector<bool> removed(n, false);
-    
-    // Initialize degrees
-    for (int i = 0; i < n; i++) {
-        degrees[i] = adj_list[i].size();
-    }
+    std::vector<int> ordering;
+    std::vector<int> core;
+    peel(ordering, core);
     
     int degeneracy = 0;
-    
-    // Repeatedly remove vertex with minimum degree
-    for (int iter = 0; iter < n; iter++) {
-        int min_degree = n + 1;
-        int min_vertex = -1;
-        
-        for (int v = 0; v < n; v++) {
-            if (!removed[v] && degrees[v] < min_degree) {
-                min_degree = degrees[v];
-                min_vertex = v;
-            }
-        }
-        
-        degeneracy = std::max(degeneracy, min_degree);
-        removed[min_vertex] = true;
-        
-        // Update degrees of neighbors
-        for (int neighbor : adj_list[min_vertex]) {
-            if (!removed[neighbor]) {
-                degrees[neighbor]--;
-            }
-        }
+    for (int c : core) {
+        degeneracy = std::max(degeneracy, c);
     }
-    
     return degeneracy;
 }
 
+std::vector<int> Graph::compute_core_numbers() const {
+    std::vector<int> ordering;
+    std::vector<int> core;
+    peel(ordering, core);
+    return core;
+}
+
 double Graph::get_density() const {
     if (n <= 1) return 0.0;
     return (2.0 * m) / (n * (n - 1.0));
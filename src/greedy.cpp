@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <unordered_set>
 #include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 /**
  * Greedy algorithm for maximum clique problem
@@ -18,15 +21,47 @@
  * Space complexity: O(V)
  * 
  * Note: This is a fast heuristic but doesn't guarantee optimal solution
+ * 
+ * Multi-start mode (find_clique_multistart):
+ * 1. Compute degeneracy ordering; every clique lies inside the later
+ *    neighbors of its earliest vertex v (at most d of them)
+ * 2. For every v, build a bitset matrix over v's later neighbors and grow
+ *    a clique from v, always adding the candidate with the most
+ *    neighbors among the remaining candidates
+ * 3. Skip or stop a run once |C| + |candidates| cannot beat the best
+ *    clique so far; optionally also drop vertices whose core number is
+ *    below the best size
+ * Starts run on a thread pool, largest first, sharing the best size.
+ * Time complexity: O(n * d³ / 64), d = degeneracy
  */
 class GreedyClique {
 public:
+    /**
+     * Result of the multi-start greedy
+     */
+    struct MultiStartResult {
+        std::vector<int> clique;       // Largest clique found
+        std::vector<int> lower_bound;  // Largest clique found containing each vertex (≥ 1)
+    };
+    
     /**
      * Find a maximal clique using greedy approach
      * @param g Input graph
      * @return Vector of vertex IDs forming the clique
      */
     static std::vector<int> find_clique(const Graph& g);
+    
+    /**
+     * Grow a greedy clique from every vertex and keep the largest
+     * Exact solvers use this as their initial incumbent.
+     * @param g Input graph
+     * @param core_filter Only use vertices whose core number is at least
+     *        the best size so far
+     * @param num_threads Worker threads (0 = std::thread::hardware_concurrency())
+     * @return Best clique and per-vertex lower bounds
+     */
+    static MultiStartResult find_clique_multistart(const Graph& g, bool core_filter = true,
+                                                   int num_threads = 0);
 };
 
 
@@ -69,3 +104,136 @@ std::vector<int> GreedyClique::find_clique(const Graph& g) {
     
     return clique;
 }
+
+GreedyClique::MultiStartResult GreedyClique::find_clique_multistart(const Graph& g,
+                                                                   bool core_filter,
+                                                                   int num_threads) {
+    using Word = bitset_ops::Word;
+    int n = g.num_vertices();
+    MultiStartResult result;
+    result.lower_bound.assign(n, 1);
+    if (n == 0) return result;
+    
+    if (num_threads <= 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    
+    std::vector<int> ordering;
+    std::vector<int> core;
+    g.peel(ordering, core);
+    std::vector<int> position(n);
+    for (int i = 0; i < n; i++) {
+        position[ordering[i]] = i;
+    }
+    
+    // One start per vertex: (number of later neighbors, position)
+    std::vector<std::pair<int, int>> starts;
+    starts.reserve(n);
+    for (int i = 0; i < n; i++) {
+        int later = 0;
+        for (int u : g.get_neighbors(ordering[i])) {
+            if (position[u] > i) later++;
+        }
+        starts.push_back({later, i});
+    }
+    
+    // Largest candidate sets first: they find big cliques early
+    std::sort(starts.begin(), starts.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    
+    result.clique.assign(1, ordering[0]);
+    std::atomic<int> best_size(1);
+    std::mutex result_mutex;
+    std::atomic<size_t> next_start(0);
+    
+    auto worker = [&]() {
+        BitsetSubgraph sub;
+        std::vector<int> later;
+        std::vector<Word> P;
+        std::vector<int> clique;
+        std::vector<int> lower_bound(n, 1);
+        
+        for (size_t t = next_start++; t < starts.size(); t = next_start++) {
+            int best = best_size.load(std::memory_order_relaxed);
+            
+            // Starts are sorted, so no later one can beat the best either
+            if (starts[t].first + 1 <= best) break;
+            
+            int i = starts[t].second;
+            int v = ordering[i];
+            if (core_filter && core[v] < best) continue;
+            
+            // Candidates = later neighbors of v that could be in a larger clique
+            later.clear();
+            for (int u : g.get_neighbors(v)) {
+                if (position[u] > i && (!core_filter || core[u] >= best)) {
+                    later.push_back(u);
+                }
+            }
+            if ((int)later.size() + 1 <= best) continue;
+            
+            sub.build(g, later);
+            int words = sub.words();
+            P.assign(words, 0);
+            for (int j = 0; j < sub.size(); j++) {
+                bitset_ops::set_bit(P.data(), j);
+            }
+            
+            clique.assign(1, v);
+            while (!bitset_ops::none(P.data(), words)) {
+                // Stop once this run cannot beat the best
+                int remaining = bitset_ops::count(P.data(), words);
+                if ((int)clique.size() + remaining <= best_size.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                
+                // Pick candidate with most neighbors among the candidates
+                int next_v = -1;
+                int max_deg = -1;
+                bitset_ops::for_each(P.data(), words, [&](int u) {
+                    int deg = bitset_ops::intersect_count(P.data(), sub.row(u), words);
+                    if (deg > max_deg) {
+                        max_deg = deg;
+                        next_v = u;
+                    }
+                });
+                
+                clique.push_back(sub.global_id(next_v));
+                bitset_ops::intersect(P.data(), P.data(), sub.row(next_v), words);
+            }
+            
+            int size = clique.size();
+            for (int u : clique) {
+                lower_bound[u] = std::max(lower_bound[u], size);
+            }
+            
+            if (size > best_size.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(result_mutex);
+                if (size > (int)result.clique.size()) {
+                    result.clique = clique;
+                    best_size.store(size, std::memory_order_relaxed);
+                }
+            }
+        }
+        
+        std::lock_guard<std::mutex> lock(result_mutex);
+        for (int u = 0; u < n; u++) {
+            result.lower_bound[u] = std::max(result.lower_bound[u], lower_bound[u]);
+        }
+    };
+    
+    int threads = std::max(1, std::min<int>(num_threads, n));
+    if (threads == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+        for (auto& th : pool) {
+            th.join();
+        }
+    }
+    
+    return result;
+}
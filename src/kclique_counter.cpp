@@ -0,0 +1,326 @@
+// kclique_counter.cpp - k-clique counting from succinct clique trees (Pivoter)
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <stdexcept>
+
+#ifndef KCLIQUE_COUNTER_HPP
+#define KCLIQUE_COUNTER_HPP
+
+
+/**
+ * k-clique counting with Pivoter
+ *
+ * Counts every k-clique for all k at once, without listing them.
+ *
+ * Algorithm:
+ * 1. Compute degeneracy ordering; each clique is counted from its
+ *    earliest vertex v, inside v's later neighbors (at most d of them)
+ * 2. Recurse with Tomita pivoting, building a succinct clique tree.
+ *    Each node is a pair (hold, pivot) of vertex counts:
+ *    - Pick pivot u ∈ P maximizing |P ∩ N(u)|
+ *    - Pivot branch: P ∩ N(u), with u added as a pivot vertex
+ *    - For each v_i ∈ P \ N[u]: P ∩ N(v_i) \ {v_1..v_{i-1}}, with v_i
+ *      added as a hold vertex
+ * 3. A leaf with h hold and p pivot vertices stands for every clique
+ *    made of all hold vertices and any j of the pivots, which adds
+ *    C(p, j) to the count of (h + j)-cliques
+ *
+ * Every clique is represented by exactly one leaf, so the counts are
+ * exact. Subproblems are solved on local bitset matrices, one thread pool
+ * worker per root vertex, and per-worker counts are summed at the end.
+ *
+ * Counts are unsigned 128-bit integers. A count that would overflow
+ * (dense graphs with very large cliques) raises runtime_error instead of
+ * wrapping.
+ *
+ * Time complexity: O(n * 3^(d/3)) tree nodes, d = degeneracy
+ * Space complexity: O(n + d² / 64) words per worker
+ *
+ * Reference: Jain, Seshadhri (2020) "The Power of Pivoting for Exact
+ *            Clique Counting"
+ */
+class KCliqueCounter {
+public:
+    using Count = unsigned __int128;
+
+    /**
+     * Constructor
+     * @param max_k Largest clique size to count (0 = up to clique number)
+     * @param num_threads Worker threads (0 = std::thread::hardware_concurrency())
+     */
+    KCliqueCounter(int max_k = 0, int num_threads = 0);
+
+    /**
+     * Count k-cliques for every k
+     * @param g Input graph
+     * @return counts[k] = number of k-cliques for k = 1..K (counts[0] unused).
+     *         With max_k = 0 the vector ends at the clique number.
+     * @throws runtime_error if a count exceeds 128 bits
+     */
+    std::vector<Count> count(const Graph& g);
+
+    /**
+     * Decimal representation of a 128-bit count
+     */
+    static std::string to_string(Count c);
+
+private:
+    using Word = bitset_ops::Word;
+
+    /**
+     * Per-worker scratch space and partial counts
+     */
+    struct Workspace {
+        BitsetSubgraph sub;        // Adjacency among v's later neighbors
+        std::vector<Word> levels;  // Candidate bitset for each tree depth
+        std::vector<Word> branch;  // P \ N[pivot] for each tree depth
+        std::vector<int> later;
+        std::vector<Count> counts;
+    };
+
+    int max_k;
+    int num_threads;
+    int limit;  // Largest k tracked in this run
+
+    // binomial[p][j] = C(p, j); binomial_overflow marks values past 128 bits
+    std::vector<std::vector<Count>> binomial;
+    std::vector<std::vector<bool>> binomial_overflow;
+
+    /**
+     * Fill Pascal's triangle up to row max_p
+     */
+    void build_binomials(int max_p);
+
+    /**
+     * Build and count the subtree rooted at ordering[i]
+     */
+    void solve_root(int i, const std::vector<int>& ordering,
+                    const std::vector<int>& position,
+                    const Graph& g, Workspace& ws);
+
+    /**
+     * Succinct clique tree recursion
+     * @param ws Worker scratch space
+     * @param depth Index of candidate bitset in ws.levels
+     * @param hold Number of hold vertices (always in the clique)
+     * @param pivots Number of pivot vertices (each optionally in the clique)
+     */
+    void sct(Workspace& ws, int depth, int hold, int pivots);
+
+    /**
+     * Add C(pivots, j) to counts[hold + j] for every j
+     */
+    void record(Workspace& ws, int hold, int pivots);
+};
+
+#endif // KCLIQUE_COUNTER_HPP
+
+
+
+KCliqueCounter::KCliqueCounter(int max_k, int num_threads)
+    : max_k(std::max(max_k, 0)), num_threads(num_threads), limit(0) {
+    if (this->num_threads <= 0) {
+        this->num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+std::string KCliqueCounter::to_string(Count c) {
+    if (c == 0) return "0";
+    std::string digits;
+    while (c > 0) {
+        digits.push_back('0' + (int)(c % 10));
+        c /= 10;
+    }
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+void KCliqueCounter::build_binomials(int max_p) {
+    binomial.assign(max_p + 1, std::vector<Count>());
+    binomial_overflow.assign(max_p + 1, std::vector<bool>());
+
+    for (int p = 0; p <= max_p; p++) {
+        binomial[p].assign(p + 1, 1);
+        binomial_overflow[p].assign(p + 1, false);
+        for (int j = 1; j < p; j++) {
+            Count sum;
+            bool overflow = __builtin_add_overflow(binomial[p - 1][j - 1], binomial[p - 1][j], &sum);
+            binomial[p][j] = sum;
+            binomial_overflow[p][j] = overflow ||
+                binomial_overflow[p - 1][j - 1] || binomial_overflow[p - 1][j];
+        }
+    }
+}
+
+void KCliqueCounter::record(Workspace& ws, int hold, int pivots) {
+    int top = std::min(pivots, limit - hold);
+    for (int j = 0; j <= top; j++) {
+        if (binomial_overflow[pivots][j] ||
+            __builtin_add_overflow(ws.counts[hold + j], binomial[pivots][j], &ws.counts[hold + j])) {
+            throw std::runtime_error("k-clique count exceeds 128 bits (k = " +
+                                     std::to_string(hold + j) + ")");
+        }
+    }
+}
+
+void KCliqueCounter::sct(Workspace& ws, int depth, int hold, int pivots) {
+    // Every clique below has all hold vertices, so none fits under the limit
+    if (hold > limit) {
+        return;
+    }
+
+    int words = ws.sub.words();
+    Word* P = ws.levels.data() + (size_t)depth * words;
+    Word* next = P + words;
+
+    if (bitset_ops::none(P, words)) {
+        record(ws, hold, pivots);
+        return;
+    }
+
+    // Choose pivot from P that maximizes |P ∩ N(pivot)|
+    int pivot = -1;
+    int max_intersection = -1;
+    bitset_ops::for_each(P, words, [&](int u) {
+        int c = bitset_ops::intersect_count(P, ws.sub.row(u), words);
+        if (c > max_intersection) {
+            max_intersection = c;
+            pivot = u;
+        }
+    });
+
+    // Branch on P \ N[pivot], computed before P changes
+    Word* candidates = ws.branch.data() + (size_t)depth * words;
+    const Word* pivot_row = ws.sub.row(pivot);
+    for (int w = 0; w < words; w++) {
+        candidates[w] = P[w] & ~pivot_row[w];
+    }
+    bitset_ops::reset_bit(candidates, pivot);
+
+    // Pivot branch: cliques avoiding all of P \ N[pivot]
+    bitset_ops::intersect(next, P, pivot_row, words);
+    sct(ws, depth + 1, hold, pivots + 1);
+
+    // Hold branches: cliques containing v and no earlier candidate
+    bitset_ops::for_each(candidates, words, [&](int v) {
+        bitset_ops::intersect(next, P, ws.sub.row(v), words);
+        sct(ws, depth + 1, hold + 1, pivots);
+        bitset_ops::reset_bit(P, v);
+    });
+}
+
+void KCliqueCounter::solve_root(int i, const std::vector<int>& ordering,
+                                const std::vector<int>& position,
+                                const Graph& g, Workspace& ws) {
+    int v = ordering[i];
+
+    // P = neighbors of v that come after v in ordering
+    ws.later.clear();
+    for (int u : g.get_neighbors(v)) {
+        if (position[u] > i) {
+            ws.later.push_back(u);
+        }
+    }
+
+    ws.sub.build(g, ws.later);
+    int k = ws.sub.size();
+    int words = ws.sub.words();
+
+    ws.levels.resize((size_t)(k + 2) * words);
+    ws.branch.resize((size_t)(k + 1) * words);
+    std::fill(ws.levels.begin(), ws.levels.begin() + words, 0);
+    for (int j = 0; j < k; j++) {
+        bitset_ops::set_bit(ws.levels.data(), j);
+    }
+
+    // v is the single hold vertex at the root
+    sct(ws, 0, 1, 0);
+}
+
+std::vector<KCliqueCounter::Count> KCliqueCounter::count(const Graph& g) {
+    int n = g.num_vertices();
+    std::vector<int> ordering = g.compute_degeneracy_ordering();
+    std::vector<int> position(n);
+    for (int i = 0; i < n; i++) {
+        position[ordering[i]] = i;
+    }
+
+    // One root per vertex: (number of later neighbors, position)
+    std::vector<std::pair<int, int>> roots;
+    int degeneracy = 0;
+    for (int i = 0; i < n; i++) {
+        int later = 0;
+        for (int u : g.get_neighbors(ordering[i])) {
+            if (position[u] > i) later++;
+        }
+        degeneracy = std::max(degeneracy, later);
+        roots.push_back({later, i});
+    }
+
+    // Largest subproblems first, so the pool doesn't end on a long tail
+    std::sort(roots.begin(), roots.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    // No clique is larger than d + 1
+    limit = (max_k > 0) ? std::min(max_k, degeneracy + 1) : degeneracy + 1;
+    build_binomials(degeneracy + 1);
+
+    std::vector<Count> total(limit + 1, 0);
+    std::mutex total_mutex;
+    std::atomic<size_t> next_root(0);
+    std::atomic<bool> failed(false);
+    std::string error;
+
+    auto worker = [&]() {
+        Workspace ws;
+        ws.counts.assign(limit + 1, 0);
+        try {
+            for (size_t t = next_root++; t < roots.size() && !failed; t = next_root++) {
+                solve_root(roots[t].second, ordering, position, g, ws);
+            }
+        } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(total_mutex);
+            failed = true;
+            error = e.what();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(total_mutex);
+        for (int k = 0; k <= limit; k++) {
+            if (__builtin_add_overflow(total[k], ws.counts[k], &total[k])) {
+                failed = true;
+                error = "k-clique count exceeds 128 bits (k = " + std::to_string(k) + ")";
+            }
+        }
+    };
+
+    int threads = std::max(1, std::min<int>(num_threads, roots.size()));
+    if (threads == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+        for (auto& th : pool) {
+            th.join();
+        }
+    }
+
+    if (failed) {
+        throw std::runtime_error(error);
+    }
+
+    // Without a limit, trim to the clique number
+    if (max_k == 0) {
+        while (total.size() > 1 && total.back() == 0) {
+            total.pop_back();
+        }
+    }
+
+    return total;
+}
@@ -20,8 +20,10 @@
  * 
  * Algorithm by Tomita et al., extended with dynamic coloring
  * 
+ * The search runs on an explicit SearchStack rather than native recursion.
+ * 
  * Time complexity: O(3^(n/3)) worst case, but significantly faster in practice
- * Space complexity: O(n) for recursion depth + coloring
+ * Space complexity: O(n) frames + coloring
  * 
  * Typically 2-10x faster than standard Tomita on dense graphs
  */
@@ -34,9 +36,51 @@ public:
      */
     std::vector<int> find_maximum_clique(const Graph& g);
     
+    /**
+     * Stop after this many seconds and return the incumbent
+     * @param seconds Wall-clock limit (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Get number of nodes explored by the last search
+     */
+    long long get_nodes_explored() const { return nodes_explored; }
+    
+    /**
+     * Search-tree statistics of the last search (empty unless built with -DSEARCH_STATS)
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
+    /**
+     * Search node: R is the path of frame vertices from the root
+     */
+    struct Frame {
+        int vertex = -1;               // Vertex added to R at this node
+        std::unordered_set<int> P;     // Candidate set
+        std::vector<int> branches;     // P by color (highest first), then degree
+        std::vector<int> colour;       // Color of each branch vertex
+        size_t next = 0;
+        
+        void exclude(int v) {
+            P.erase(v);
+        }
+        
+    };
+    
     const Graph* graph;
     std::vector<int> max_clique;
+    SearchStack<Frame> stack;
+    double time_limit = 0.0;
+    bool stopped = false;
+    long long nodes_explored = 0;
+    SearchStatsRecorder recorder;
     
     /**
      * Greedy sequential graph coloring for candidate set P
@@ -47,22 +91,27 @@ private:
     std::pair<std::vector<int>, int> color_graph(const std::unordered_set<int>& P);
     
     /**
-     * Recursive MaxCliqueDyn procedure with dynamic coloring
-     * @param R Current clique
-     * @param P Candidate set
-     * @param g Graph
+     * Leaf check, dynamic coloring and branch ordering for a freshly
+     * pushed frame
+     * @return false if the node is closed and should be popped
      */
-    void maxclique_dyn_recursive(std::vector<int>& R,
-                                 std::unordered_set<int>& P);
+    bool enter();
+    
+    /**
+     * One step of MaxCliqueDyn on the top frame: branch on the next
+     * vertex in color order, or pop when none are left or the color
+     * bound prunes the rest
+     */
+    void step();
     
     /**
      * Compute intersection of set P and vertex neighbors
      * @param P Input set
      * @param v Vertex
-     * @return P ∩ N(v) as unordered_set
+     * @param out Receives P ∩ N(v)
      */
-    std::unordered_set<int> intersect_with_neighbors(
-        const std::unordered_set<int>& P, int v);
+    void intersect_with_neighbors(const std::unordered_set<int>& P, int v,
+                                  std::unordered_set<int>& out);
     
     /**
      * Order vertices by degree (descending) for coloring
@@ -70,30 +119,20 @@ private:
      * @return Vector of vertices ordered by degree
      */
     std::vector<int> order_by_degree(const std::unordered_set<int>& P);
-    
-    /**
-     * Find initial greedy clique for better lower bound
-     * @param g Graph
-     * @return Greedy clique
-     */
-    std::vector<int> find_greedy_clique(const Graph& g);
 };
 
 
 
-std::unordered_set<int> MaxCliqueDyn::intersect_with_neighbors(
-    const std::unordered_set<int>& P, int v) {
-    
-    std::unordered_set<int> result;
+void MaxCliqueDyn::intersect_with_neighbors(const std::unordered_set<int>& P, int v,
+                                            std::unordered_set<int>& out) {
+    out.clear();
     const auto& neighbors = graph->get_neighbors(v);
     
     for (int u : P) {
         if (neighbors.find(u) != neighbors.end()) {
-            result.insert(u);
+            out.insert(u);
         }
     }
-    
-    return result;
 }
 
 std::vector<int> MaxCliqueDyn::order_by_degree(const std::unordered_set<int>& P) {
@@ -118,64 +157,6 @@ std::vector<int> MaxCliqueDyn::order_by_degree(const std::unordered_set<int>& P)
     return vertices;
 }
 
-std::vector<int> MaxCliqueDyn::find_greedy_clique(const Graph& g) {
-    std::vector<int> clique;
-    int n = g.num_vertices();
-    
-    // Start with highest degree vertex
-    int best_v = -1;
-    int best_deg = -1;
-    for (int v = 0; v < n; v++) {
-        int deg = g.get_neighbors(v).size();
-        if (deg > best_deg) {
-            best_deg = deg;
-            best_v = v;
-        }
-    }
-    
-    if (best_v == -1) return clique;
-    
-    clique.push_back(best_v);
-    
-    // Greedily add vertices that are connected to all current clique members
-    std::unordered_set<int> candidates(g.get_neighbors(best_v).begin(), 
-                                       g.get_neighbors(best_v).end());
-    
-    while (!candidates.empty()) {
-        // Pick candidate with highest degree in candidates
-        int next_v = -1;
-        int max_deg = -1;
-        
-        for (int v : candidates) {
-            int deg = 0;
-            const auto& neighbors = g.get_neighbors(v);
-            for (int u : candidates) {
-                if (neighbors.find(u) != neighbors.end()) deg++;
-            }
-            if (deg > max_deg) {
-                max_deg = deg;
-                next_v = v;
-            }
-        }
-        
-        if (next_v == -1) break;
-        
-        clique.push_back(next_v);
-        
-        // Update candidates: intersect with neighbors of next_v
-        std::unordered_set<int> new_candidates;
-        const auto& neighbors = g.get_neighbors(next_v);
-        for (int v : candidates) {
-            if (v != next_v && neighbors.find(v) != neighbors.end()) {
-                new_candidates.insert(v);
-            }
-        }
-        candidates = new_candidates;
-    }
-    
-    return clique;
-}
-
 std::pair<std::vector<int>, int> MaxCliqueDyn::color_graph(
     const std::unordered_set<int>& P) {
     
@@ -217,15 +198,25 @@ std::pair<std::vector<int>, int> MaxCliqueDyn::color_graph(
     return {colors, max_color + 1};  // +1 because colors are 0-indexed
 }
 
-void MaxCliqueDyn::maxclique_dyn_recursive(std::vector<int>& R,
-                                           std::unordered_set<int>& P) {
+bool MaxCliqueDyn::enter() {
+    nodes_explored++;
+    
+    Frame& f = stack.back();
+    size_t r = stack.depth() - 1;  // |R|
+    const auto& P = f.P;
+    recorder.node(r);
     
     // Base case: P is empty
     if (P.empty()) {
-        if (R.size() > max_clique.size()) {
-            max_clique = R;
+        recorder.leaf();
+        if (r > max_clique.size()) {
+            max_clique.clear();
+            for (size_t d = 1; d < stack.depth(); d++) {
+                max_clique.push_back(stack[d].vertex);
+            }
+            recorder.incumbent(r);
         }
-        return;
+        return false;
     }
     
     // Dynamic coloring of P
@@ -234,8 +225,9 @@ void MaxCliqueDyn::maxclique_dyn_recursive(std::vector<int>& R,
     // PRUNING: If current clique + chromatic number <= best, prune
     // χ(P) is an upper bound on the maximum independent set in complement
     // Therefore, |R| + χ(P) is upper bound on maximum clique
-    if (R.size() + chromatic_number <= max_clique.size()) {
-        return;  // Cannot improve best clique
+    if (r + chromatic_number <= max_clique.size()) {
+        recorder.coloring_prune();
+        return false;  // Cannot improve best clique
     }
     
     // Group vertices by color
@@ -248,12 +240,10 @@ void MaxCliqueDyn::maxclique_dyn_recursive(std::vector<int>& R,
     
     // Process vertices in reverse color order (highest color first)
     // Vertices with higher colors have better chance of being in large cliques
+    f.branches.clear();
+    f.colour.clear();
+    f.next = 0;
     for (int c = chromatic_number - 1; c >= 0; c--) {
-        // OPTIMIZATION: Enhanced pruning per color class
-        if (R.size() + (c + 1) <= max_clique.size()) {
-            return;  // Even with all remaining color classes, cannot beat best
-        }
-        
         // OPTIMIZATION: Order vertices within color class by degree (descending)
         std::vector<int>& color_class = color_classes[c];
         std::sort(color_class.begin(), color_class.end(),
@@ -269,48 +259,76 @@ void MaxCliqueDyn::maxclique_dyn_recursive(std::vector<int>& R,
                   });
         
         for (int v : color_class) {
-            // OPTIMIZATION: Check if this branch can improve
-            // Current size + remaining colors (including this one)
-            if (R.size() + (c + 1) <= max_clique.size()) {
-                return;  // Even with all remaining vertices, cannot beat best
-            }
-            
-            // Add v to current clique
-            R.push_back(v);
-            
-            // Compute new candidate set: P ∩ N(v)
-            std::unordered_set<int> P_new = intersect_with_neighbors(P, v);
-            
-            // Recurse
-            maxclique_dyn_recursive(R, P_new);
-            
-            // Backtrack
-            R.pop_back();
-            
-            // Remove v from P for next iteration
-            P.erase(v);
+            f.branches.push_back(v);
+            f.colour.push_back(c);
         }
     }
+    
+    return true;
+}
+
+void MaxCliqueDyn::step() {
+    size_t d = stack.depth() - 1;
+    Frame& f = stack[d];
+    
+    // OPTIMIZATION: Check if this branch can improve
+    // Current size + remaining colors (including this one)
+    if (f.next == f.branches.size()) {
+        stack.pop();
+        return;
+    }
+    if (d + (f.colour[f.next] + 1) <= max_clique.size()) {
+        recorder.coloring_prune();
+        stack.pop();
+        return;
+    }
+    
+    int v = f.branches[f.next++];
+    
+    // Child: R∪{v}, P∩N(v)
+    Frame& child = stack.push();
+    Frame& parent = stack[d];
+    child.vertex = v;
+    intersect_with_neighbors(parent.P, v, child.P);
+    
+    // Remove v from P for next iteration
+    parent.exclude(v);
+    
+    if (!enter()) {
+        stack.pop();
+    }
 }
 
 std::vector<int> MaxCliqueDyn::find_maximum_clique(const Graph& g) {
+    SearchDeadline deadline;
+    deadline.start(time_limit);
+    stopped = false;
+    nodes_explored = 0;
+    recorder.start();
+    
     graph = &g;
     
-    // OPTIMIZATION: Seed with greedy clique for better initial lower bound
-    max_clique = find_greedy_clique(g);
+    // OPTIMIZATION: Seed with multi-start greedy clique for better initial lower bound
+    max_clique = GreedyClique::find_clique_multistart(g).clique;
+    recorder.incumbent(max_clique.size());
+    
+    // Root: R empty, P = all vertices
+    stack.clear();
+    Frame& root = stack.push();
+    root.vertex = -1;
+    root.P.clear();
     
-    // Initialize candidate set P with all vertices
-    std::unordered_set<int> P;
     int n = g.num_vertices();
     for (int v = 0; v < n; v++) {
-        P.insert(v);
+        root.P.insert(v);
     }
     
-    // Initialize current clique R (empty)
-    std::vector<int> R;
-    
     // Run algorithm
-    maxclique_dyn_recursive(R, P);
+    if (enter()) {
+        stopped = !stack.run_until([&](SearchStack<Frame>&) { step(); }, deadline);
+    } else {
+        stack.clear();
+    }
     
     return max_clique;
 }
@@ -1,27 +1,30 @@
 // ostergard.cpp - Merged from ostergard.hpp
 #include <vector>
 #include <algorithm>
-#include <unordered_set>
-#include <unordered_map>
 #include <string>
 
 /**
- * Östergård's algorithm for maximum clique
+ * Östergård's algorithm for maximum clique (Cliquer)
  * 
- * Branch-and-bound algorithm with vertex coloring for upper bounds
+ * Branch-and-bound driven by a table of best clique sizes on suffixes
+ * of a fixed vertex ordering v_0, ..., v_{n-1}
  * 
  * Key ideas:
- * 1. Order vertices by decreasing degree
- * 2. Use greedy graph coloring to compute upper bound on clique size
- * 3. Prune branches when: current_size + upper_bound ≤ best_known_size
- * 4. Branch on vertices in order, maintaining candidate set
+ * 1. Let S_i = {v_i, ..., v_{n-1}} and c[i] = ω(G[S_i])
+ * 2. Process i from n-1 down to 0, searching only for cliques that
+ *    contain v_i and lie inside S_i, then record c[i]
+ * 3. While expanding, a candidate v_j can only lead to a clique of size
+ *    |current| + c[j], so prune when c[j] + |current| <= best
+ * 4. c[i] <= c[i+1] + 1, so the search for v_i stops as soon as it
+ *    finds one improvement
  * 
- * Coloring bound: If vertices can be colored with k colors, 
- * then maximum clique size in that subgraph is at most k
- * (because clique vertices must all have different colors)
+ * Vertices are ordered by degeneracy, so v_i's candidates N(v_i) ∩ S_{i+1}
+ * number at most d. Each subproblem relabels those candidates into a local
+ * bitset adjacency matrix, and candidate sets are bitsets over it. The
+ * search runs on an explicit SearchStack rather than native recursion.
  * 
  * Time complexity: Exponential, but with effective pruning
- * Space complexity: O(n) for recursion
+ * Space complexity: O(n + d² / 64) words
  * 
  * Reference: Östergård (2002) "A fast algorithm for the maximum clique problem"
  */
@@ -34,143 +37,217 @@ public:
      */
     std::vector<int> find_maximum_clique(const Graph& g);
     
+    /**
+     * Stop after this many seconds and return the incumbent
+     * @param seconds Wall-clock limit (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Get number of nodes explored by the last search
+     */
+    long long get_nodes_explored() const { return nodes_explored; }
+    
+    /**
+     * Search-tree statistics of the last search (empty unless built with -DSEARCH_STATS)
+     * Depth is the clique size, so each subproblem root is at depth 1.
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
+    using Word = bitset_ops::Word;
+    
+    /**
+     * Search node: the clique is the path of frame vertices (global IDs),
+     * starting with v_i at the root
+     */
+    struct Frame {
+        int vertex = -1;               // Vertex added at this node (global ID)
+        std::vector<Word> U;           // Candidates (local IDs)
+        
+        void exclude(int j) {
+            bitset_ops::reset_bit(U.data(), j);
+        }
+    };
+    
     std::vector<int> max_clique;
+    std::vector<int> c;              // c[i] = ω(G[S_i]), indexed by ordering position
+    bool found;                      // Improvement found for current v_i
+    double time_limit = 0.0;
+    bool stopped = false;
+    long long nodes_explored = 0;
+    SearchStatsRecorder recorder;
+    
+    // Per-subproblem state
+    BitsetSubgraph sub;              // Adjacency among v_i's later neighbors
+    std::vector<int> sub_position;   // Ordering position of each local vertex
+    SearchStack<Frame> stack;
     
     /**
-     * Compute upper bound on clique size using greedy coloring
-     * Colors vertices greedily and returns number of colors used
-     * 
-     * @param candidates Candidate vertices
-     * @param g Graph
-     * @return Upper bound (number of colors)
+     * Leaf check for a freshly pushed frame; opens all its candidates
+     * @return false if the node is closed and should be popped
      */
-    int color_bound(const std::vector<int>& candidates, const Graph& g);
+    bool enter();
     
     /**
-     * Branch-and-bound recursive procedure
-     * @param current Current clique being constructed
-     * @param candidates Remaining candidate vertices
-     * @param g Graph
+     * One step of the search on the top frame: extend the clique with the
+     * next candidate, or pop when pruned or exhausted
      */
-    void branch_and_bound(std::vector<int> current,
-                         std::vector<int> candidates,
-                         const Graph& g);
+    void step();
 };
 
 
 
-int OstergardAlgorithm::color_bound(const std::vector<int>& candidates, const Graph& g) {
-    if (candidates.empty()) return 0;
-    
-    // Greedy coloring to get upper bound
-    std::unordered_map<int, int> vertex_color;
-    int num_colors = 0;
-    
-    for (int v : candidates) {
-        // Find smallest color not used by neighbors
-        std::vector<bool> used_colors(candidates.size() + 1, false);
-        
-        for (int u : candidates) {
-            if (u != v && g.has_edge(v, u) && vertex_color.find(u) != vertex_color.end()) {
-                used_colors[vertex_color[u]] = true;
+bool OstergardAlgorithm::enter() {
+    nodes_explored++;
+    Frame& f = stack.back();
+    int words = sub.words();
+    int size = stack.depth();
+    recorder.node(size);
+    
+    // U empty: current cannot be extended
+    if (bitset_ops::none(f.U.data(), words)) {
+        recorder.leaf();
+        if (size > (int)max_clique.size()) {
+            max_clique.clear();
+            for (size_t d = 0; d < stack.depth(); d++) {
+                max_clique.push_back(stack[d].vertex);
             }
+            found = true;
+            recorder.incumbent(size);
         }
-        
-        // Assign smallest available color
-        int color = 0;
-        while (used_colors[color]) {
-            color++;
-        }
-        
-        vertex_color[v] = color;
-        num_colors = std::max(num_colors, color + 1);
+        return false;
     }
     
-    return num_colors;
+    return true;
 }
 
-void OstergardAlgorithm::branch_and_bound(std::vector<int> current,
-                                          std::vector<int> candidates,
-                                          const Graph& g) {
-    // Update best solution if current is better
-    if (current.size() > max_clique.size()) {
-        max_clique = current;
+// Inline so run() compiles to a flat loop; this is the hot path
+inline void OstergardAlgorithm::step() {
+    size_t d = stack.depth() - 1;
+    Frame& f = stack[d];
+    int words = sub.words();
+    int size = stack.depth();
+    
+    // Candidates are taken in ordering position
+    int j = bitset_ops::first(f.U.data(), words);
+    if (j < 0) {
+        stack.pop();
+        return;
     }
     
-    // Base case: no more candidates
-    if (candidates.empty()) {
+    // Pruning: even taking every candidate can't beat best
+    if (size + bitset_ops::count(f.U.data(), words) <= (int)max_clique.size()) {
+        recorder.size_prune();
+        stack.pop();
         return;
     }
     
-    // Compute upper bound using coloring
-    int upper_bound = color_bound(candidates, g);
-    
-    // Pruning: if current + upper_bound can't beat best, skip this branch
-    if (current.size() + upper_bound <= max_clique.size()) {
+    // U ⊆ S_j for the first remaining candidate, so c[j] bounds any clique inside
+    if (size + c[sub_position[j]] <= (int)max_clique.size()) {
+        recorder.suffix_prune();
+        stack.pop();
         return;
     }
+    f.exclude(j);
     
-    // Try adding each candidate vertex
-    while (!candidates.empty()) {
-        // Take last vertex (highest degree due to initial sorting)
-        int v = candidates.back();
-        candidates.pop_back();
-        
-        // Pruning: if current + remaining + 1 can't beat best, stop
-        if (current.size() + candidates.size() + 1 <= max_clique.size()) {
-            break;
-        }
-        
-        // Create new current clique with v
-        std::vector<int> new_current = current;
-        new_current.push_back(v);
-        
-        // Create new candidate set: vertices connected to v and all in current
-        std::vector<int> new_candidates;
-        for (int u : candidates) {
-            bool connected_to_all = g.has_edge(v, u);
-            if (connected_to_all) {
-                for (int w : current) {
-                    if (!g.has_edge(u, w)) {
-                        connected_to_all = false;
-                        break;
-                    }
-                }
-            }
-            
-            if (connected_to_all) {
-                new_candidates.push_back(u);
-            }
-        }
-        
-        // Recurse
-        branch_and_bound(new_current, new_candidates, g);
+    Frame& child = stack.push();
+    Frame& parent = stack[d];
+    child.vertex = sub.global_id(j);
+    child.U.resize(words);
+    bitset_ops::intersect(child.U.data(), parent.U.data(), sub.row(j), words);
+    
+    if (!enter()) {
+        stack.pop();
+    }
+    
+    // c[i] can exceed c[i+1] by at most one
+    if (found) {
+        stack.clear();
     }
 }
 
 std::vector<int> OstergardAlgorithm::find_maximum_clique(const Graph& g) {
+    SearchDeadline deadline;
+    deadline.start(time_limit);
+    stopped = false;
+    nodes_explored = 0;
+    recorder.start();
     max_clique.clear();
     
     int n = g.num_vertices();
+    c.assign(n, 0);
     
-    // Create initial candidate list sorted by degree (descending)
-    std::vector<std::pair<int, int>> vertices_by_degree;
-    for (int v = 0; v < n; v++) {
-        vertices_by_degree.push_back({g.get_degree(v), v});
+    // Order vertices by degeneracy so every suffix neighborhood is small
+    std::vector<int> ordering = g.compute_degeneracy_ordering();
+    std::vector<int> position(n);
+    for (int i = 0; i < n; i++) {
+        position[ordering[i]] = i;
     }
     
-    std::sort(vertices_by_degree.begin(), vertices_by_degree.end(),
-              [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::vector<int> later;
     
-    std::vector<int> candidates;
-    for (const auto& [degree, v] : vertices_by_degree) {
-        candidates.push_back(v);
+    // Process vertices from last to first
+    for (int i = n - 1; i >= 0; i--) {
+        if (deadline.expired()) {
+            stopped = true;
+            break;
+        }
+        int v = ordering[i];
+        
+        // Candidates: N(v_i) ∩ S_{i+1}, in ordering position
+        later.clear();
+        for (int u : g.get_neighbors(v)) {
+            if (position[u] > i) {
+                later.push_back(u);
+            }
+        }
+        
+        // Pruning: v_i and all its later neighbors can't beat best
+        if (1 + (int)later.size() <= (int)max_clique.size()) {
+            recorder.size_prune();
+            c[i] = max_clique.size();
+            continue;
+        }
+        
+        std::sort(later.begin(), later.end(),
+                  [&position](int a, int b) { return position[a] < position[b]; });
+        
+        sub.build(g, later);
+        int k = sub.size();
+        int words = sub.words();
+        
+        sub_position.resize(k);
+        for (int j = 0; j < k; j++) {
+            sub_position[j] = position[later[j]];
+        }
+        
+        // The root holds v_i with every later neighbor as a candidate
+        stack.clear();
+        Frame& root = stack.push();
+        root.vertex = v;
+        root.U.assign(words, 0);
+        for (int j = 0; j < k; j++) {
+            bitset_ops::set_bit(root.U.data(), j);
+        }
+        
+        found = false;
+        if (enter()) {
+            stopped = !stack.run_until([&](SearchStack<Frame>&) { step(); }, deadline);
+        } else {
+            stack.clear();
+        }
+        
+        if (stopped) {
+            break;
+        }
+        c[i] = max_clique.size();
     }
     
-    // Start branch and bound
-    std::vector<int> current;
-    branch_and_bound(current, candidates, g);
-    
     return max_clique;
 }
@@ -0,0 +1,185 @@
+// perf_counters.cpp - Hardware performance counters around benchmark runs (Linux perf_event_open)
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+/**
+ * Counter values from one measurement (-1 = counter not available)
+ */
+struct PerfReading {
+    enum Event {
+        CYCLES,
+        INSTRUCTIONS,
+        L1D_MISSES,      // L1 data cache read misses
+        LLC_MISSES,      // Last-level cache read misses
+        BRANCH_MISSES,
+        DTLB_MISSES,     // Data TLB read misses
+        NUM_EVENTS
+    };
+
+    long long values[NUM_EVENTS];
+
+    PerfReading() {
+        for (long long& v : values) v = -1;
+    }
+
+    bool has(Event e) const { return values[e] >= 0; }
+    bool any() const {
+        for (long long v : values) {
+            if (v >= 0) return true;
+        }
+        return false;
+    }
+
+    /**
+     * Instructions per cycle (-1 if either counter is missing)
+     */
+    double ipc() const {
+        if (!has(CYCLES) || !has(INSTRUCTIONS) || values[CYCLES] == 0) return -1.0;
+        return (double)values[INSTRUCTIONS] / values[CYCLES];
+    }
+
+    static const char* name(Event e) {
+        static const char* names[NUM_EVENTS] = {
+            "Cycles", "Instructions", "L1DMisses", "LLCMisses", "BranchMisses", "DTLBMisses"
+        };
+        return names[e];
+    }
+};
+
+/**
+ * User-space hardware counters for the calling process and the threads
+ * it starts
+ *
+ * Each event is opened on its own, so one the CPU or kernel does not
+ * offer (virtual machines, perf_event_paranoid > 2, non-Linux builds)
+ * just reads as -1 while the others still count. Events are not grouped,
+ * because grouped reads do not cover inherited threads. If the kernel
+ * multiplexes counters, values are scaled by time enabled / time running.
+ *
+ * Usage:
+ *   PerfCounters perf;
+ *   perf.start();
+ *   run();
+ *   PerfReading r = perf.stop();
+ */
+class PerfCounters {
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * True if at least one counter could be opened
+     */
+    bool available() const;
+
+    /**
+     * Reset and enable all open counters
+     */
+    void start();
+
+    /**
+     * Disable the counters and read them
+     */
+    PerfReading stop();
+
+private:
+    int fds[PerfReading::NUM_EVENTS];
+};
+
+#endif // PERF_COUNTERS_HPP
+
+
+#ifdef __linux__
+
+static int open_perf_event(uint32_t type, uint64_t config) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.inherit = 1;         // Count worker threads started after opening
+    attr.exclude_kernel = 1;  // Allowed at perf_event_paranoid <= 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+}
+
+static uint64_t cache_event(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+PerfCounters::PerfCounters() {
+    fds[PerfReading::CYCLES] = open_perf_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    fds[PerfReading::INSTRUCTIONS] = open_perf_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    fds[PerfReading::L1D_MISSES] = open_perf_event(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_L1D));
+    fds[PerfReading::LLC_MISSES] = open_perf_event(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_LL));
+    fds[PerfReading::BRANCH_MISSES] = open_perf_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    fds[PerfReading::DTLB_MISSES] = open_perf_event(PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_DTLB));
+}
+
+PerfCounters::~PerfCounters() {
+    for (int fd : fds) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+void PerfCounters::start() {
+    for (int fd : fds) {
+        if (fd < 0) continue;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+PerfReading PerfCounters::stop() {
+    PerfReading reading;
+    for (int e = 0; e < PerfReading::NUM_EVENTS; e++) {
+        if (fds[e] < 0) continue;
+        ioctl(fds[e], PERF_EVENT_IOC_DISABLE, 0);
+
+        uint64_t data[3];  // value, time enabled, time running
+        // A counter that was never scheduled has no value
+        if (::read(fds[e], data, sizeof(data)) != (ssize_t)sizeof(data) || data[2] == 0) continue;
+        if (data[2] < data[1]) {
+            reading.values[e] = (long long)((double)data[0] * data[1] / data[2]);
+        } else {
+            reading.values[e] = data[0];
+        }
+    }
+    return reading;
+}
+
+#else
+
+PerfCounters::PerfCounters() {
+    for (int& fd : fds) fd = -1;
+}
+
+PerfCounters::~PerfCounters() {}
+
+void PerfCounters::start() {}
+
+PerfReading PerfCounters::stop() { return PerfReading(); }
+
+#endif // __linux__
+
+bool PerfCounters::available() const {
+    for (int fd : fds) {
+        if (fd >= 0) return true;
+    }
+    return false;
+}
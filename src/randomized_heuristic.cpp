@@ -6,6 +6,9 @@
 #include <unordered_map>
 #include <set>
 #include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 /**
  * Randomized local search heuristic for maximum clique problem
@@ -19,8 +22,17 @@
  * 3. Restart from new random initial solution
  * 4. Return best solution across all restarts
  * 
- * Time complexity: O(num_restarts * max_swaps * V²)
- * Space complexity: O(V)
+ * Restarts are independent and run on a thread pool. Restart i draws
+ * from its own mt19937 seeded with (seed, i), and ties between equal-size
+ * results go to the lowest restart index, so the result does not depend
+ * on the thread count.
+ * 
+ * The clique lives in a CliqueState, which keeps add and swap candidate
+ * lists up to date, so a move costs O(deg) instead of a scan of all
+ * vertices against the clique.
+ * 
+ * Time complexity: O(num_restarts * (V + max_swaps * Δ)), Δ = max degree
+ * Space complexity: O(V) per thread
  * 
  * This combines randomization with local improvement for better exploration
  */
@@ -31,163 +43,142 @@ public:
      * @param num_restarts Number of random restarts
      * @param max_swaps Maximum swap attempts per restart
      * @param seed Random seed for reproducibility (0 for random)
+     * @param num_threads Worker threads for restarts (0 = std::thread::hardware_concurrency())
      */
-    RandomizedHeuristic(int num_restarts = 10, int max_swaps = 1000, unsigned int seed = 0);
+    RandomizedHeuristic(int num_restarts = 10, int max_swaps = 1000, unsigned int seed = 0,
+                        int num_threads = 0);
     
     /**
      * Find maximum clique using randomized local search
      * @param g Input graph
+     * @param target_size Stop once a clique of this size is found (0 = run all restarts)
      * @return Vector of vertex IDs forming the clique
      */
-    std::vector<int> find_clique(const Graph& g);
+    std::vector<int> find_clique(const Graph& g, int target_size = 0);
     
 private:
     int num_restarts;
     int max_swaps;
-    std::mt19937 rng;
+    int num_threads;
+    unsigned int base_seed;
+    
+    /**
+     * Random generator for one restart, derived from (base_seed, restart)
+     */
+    std::mt19937 restart_rng(int restart) const;
     
     /**
-     * Perform local search starting from initial solution
+     * Perform local search starting from the clique in state
      * @param g Input graph
-     * @param initial Initial clique
-     * @return Improved clique
+     * @param state Initial clique; left at the final clique
+     * @param gen Random generator of this restart
+     * @return Largest clique seen
      */
-    std::vector<int> local_search(const Graph& g, std::vector<int> initial);
+    std::vector<int> local_search(const Graph& g, CliqueState& state, std::mt19937& gen);
     
     /**
      * Generate random initial clique
      * @param g Input graph
-     * @return Random valid clique
+     * @param state Receives a random maximal clique
+     * @param gen Random generator of this restart
      */
-    std::vector<int> random_initial_clique(const Graph& g);
+    void random_initial_clique(const Graph& g, CliqueState& state, std::mt19937& gen);
 };
 
 
 
-RandomizedHeuristic::RandomizedHeuristic(int num_restarts, int max_swaps, unsigned int seed)
-    : num_restarts(num_restarts), max_swaps(max_swaps) {
+RandomizedHeuristic::RandomizedHeuristic(int num_restarts, int max_swaps, unsigned int seed,
+                                         int num_threads)
+    : num_restarts(num_restarts), max_swaps(max_swaps), num_threads(num_threads) {
     if (seed == 0) {
         std::random_device rd;
-        rng.seed(rd());
+        base_seed = rd();
     } else {
-        rng.seed(seed);
+        base_seed = seed;
+    }
+    if (this->num_threads <= 0) {
+        this->num_threads = std::max(1u, std::thread::hardware_concurrency());
     }
 }
 
-std::vector<int> RandomizedHeuristic::random_initial_clique(const Graph& g) {
-    int n = g.num_vertices();
-    std::vector<int> vertices;
-    for (int v = 0; v < n; v++) {
-        vertices.push_back(v);
-    }
-    
-    // Shuffle vertices
-    std::shuffle(vertices.begin(), vertices.end(), rng);
+std::mt19937 RandomizedHeuristic::restart_rng(int restart) const {
+    std::seed_seq seq{base_seed, (unsigned int)restart};
+    return std::mt19937(seq);
+}
+
+void RandomizedHeuristic::random_initial_clique(const Graph& g, CliqueState& state,
+                                                std::mt19937& gen) {
+    state.assign(g, {});
     
-    // Greedily build clique from shuffled vertices
-    std::vector<int> clique;
-    for (int v : vertices) {
-        bool can_add = true;
-        for (int u : clique) {
-            if (!g.has_edge(v, u)) {
-                can_add = false;
-                break;
-            }
-        }
-        if (can_add) {
-            clique.push_back(v);
-        }
+    // Add a uniform random add candidate until none is left; same
+    // distribution as greedy over a shuffled vertex order
+    while (!state.add_candidates().empty()) {
+        const VertexSet& add = state.add_candidates();
+        std::uniform_int_distribution<int> idx_dist(0, add.size() - 1);
+        state.add(add[idx_dist(gen)]);
     }
-    
-    return clique;
 }
 
-std::vector<int> RandomizedHeuristic::local_search(const Graph& g, std::vector<int> current) {
-    std::vector<int> best = current;
-    int n = g.num_vertices();
+std::vector<int> RandomizedHeuristic::local_search(const Graph& g, CliqueState& state,
+                                                  std::mt19937& gen) {
+    std::vector<int> best = state.clique().elements();
     bool improved = true;
     int iterations = 0;
+    std::vector<int> freed, chosen;
     
     while (improved && iterations < max_swaps) {
         improved = false;
         iterations++;
         
-        std::unordered_set<int> current_set(current.begin(), current.end());
-        
-        // Try to add vertices that extend the clique
-        std::vector<int> candidates;
-        for (int v = 0; v < n; v++) {
-            if (current_set.find(v) == current_set.end()) {
-                bool can_add = true;
-                for (int u : current) {
-                    if (!g.has_edge(v, u)) {
-                        can_add = false;
-                        break;
-                    }
-                }
-                if (can_add) {
-                    candidates.push_back(v);
-                }
-            }
-        }
-        
-        // If we can directly extend, do it
-        if (!candidates.empty()) {
-            current.push_back(candidates[0]);
+        // If we can directly extend, do it (lowest ID first)
+        const std::vector<int>& add = state.add_candidates().elements();
+        if (!add.empty()) {
+            state.add(*std::min_element(add.begin(), add.end()));
             improved = true;
-            if (current.size() > best.size()) {
-                best = current;
+            if (state.size() > (int)best.size()) {
+                best = state.clique().elements();
             }
             continue;
         }
         
         // Try swap operations: remove one, add one or more
-        if (!current.empty()) {
-            std::uniform_int_distribution<int> idx_dist(0, current.size() - 1);
-            int remove_idx = idx_dist(rng);
-            int removed = current[remove_idx];
-            
-            std::vector<int> temp = current;
-            temp.erase(temp.begin() + remove_idx);
-            std::unordered_set<int> temp_set(temp.begin(), temp.end());
+        if (state.size() > 0) {
+            std::uniform_int_distribution<int> idx_dist(0, state.size() - 1);
+            int removed = state.clique()[idx_dist(gen)];
             
-            // Try to add vertices that weren't adjacent to removed vertex
-            std::vector<int> swap_candidates;
-            for (int v = 0; v < n; v++) {
-                if (temp_set.find(v) == temp_set.end() && v != removed) {
-                    bool can_add = true;
-                    for (int u : temp) {
-                        if (!g.has_edge(v, u)) {
-                            can_add = false;
-                            break;
-                        }
-                    }
-                    if (can_add) {
-                        swap_candidates.push_back(v);
-                    }
+            // Vertices adjacent to all members but removed: swap candidates missing it
+            freed.clear();
+            for (int v : state.swap_candidates().elements()) {
+                if (!g.has_edge(v, removed)) {
+                    freed.push_back(v);
                 }
             }
+            std::sort(freed.begin(), freed.end());
             
             // Try adding multiple vertices
-            std::vector<int> new_clique = temp;
-            for (int v : swap_candidates) {
+            chosen.clear();
+            for (int v : freed) {
                 bool can_add = true;
-                for (int u : new_clique) {
+                for (int u : chosen) {
                     if (!g.has_edge(v, u)) {
                         can_add = false;
                         break;
                     }
                 }
                 if (can_add) {
-                    new_clique.push_back(v);
+                    chosen.push_back(v);
                 }
             }
             
-            if (new_clique.size() > current.size()) {
-                current = new_clique;
+            // Only a net gain is accepted
+            if (chosen.size() > 1) {
+                state.remove(removed);
+                for (int v : chosen) {
+                    state.add(v);
+                }
                 improved = true;
-                if (current.size() > best.size()) {
-                    best = current;
+                if (state.size() > (int)best.size()) {
+                    best = state.clique().elements();
                 }
             }
         }
@@ -196,32 +187,63 @@ std::vector<int> RandomizedHeuristic::local_search(const Graph& g, std::vector<i
     return best;
 }
 
-std::vector<int> RandomizedHeuristic::find_clique(const Graph& g) {
+std::vector<int> RandomizedHeuristic::find_clique(const Graph& g, int target_size) {
     // Start with greedy solution
-    std::vector<int> best = GreedyClique::find_clique(g);
+    std::vector<int> greedy = GreedyClique::find_clique(g);
+    std::vector<int> best = greedy;
+    int best_restart = -1;  // Greedy wins ties, as if it came first
+    
+    if (target_size > 0 && (int)best.size() >= target_size) {
+        return best;
+    }
+    
+    std::mutex best_mutex;
+    std::atomic<int> next_restart(0);
+    std::atomic<bool> target_reached(false);
     
     // Perform multiple random restarts
-    for (int restart = 0; restart < num_restarts; restart++) {
-        std::vector<int> initial;
-        
-        if (restart == 0) {
-            // First restart uses greedy
-            initial = best;
-        } else {
-            // Other restarts use random initialization
-            initial = random_initial_clique(g);
+    auto worker = [&]() {
+        CliqueState state;
+        for (int restart = next_restart++; restart < num_restarts && !target_reached;
+             restart = next_restart++) {
+            std::mt19937 gen = restart_rng(restart);
+            
+            if (restart == 0) {
+                // First restart uses greedy
+                state.assign(g, greedy);
+            } else {
+                // Other restarts use random initialization
+                random_initial_clique(g, state, gen);
+            }
+            
+            // Perform local search
+            std::vector<int> result = local_search(g, state, gen);
+            
+            // Update best if improved; equal sizes keep the earliest restart
+            std::lock_guard<std::mutex> lock(best_mutex);
+            if (result.size() > best.size() ||
+                (result.size() == best.size() && restart < best_restart)) {
+                best = result;
+                best_restart = restart;
+            }
+            if (target_size > 0 && (int)best.size() >= target_size) {
+                target_reached = true;
+            }
         }
-        
-        // Perform local search
-        std::vector<int> result = local_search(g, initial);
-        
-        // Update best if improved
-        if (result.size() > best.size()) {
-            best = result;
+    };
+    
+    int threads = std::max(1, std::min(num_threads, num_restarts));
+    if (threads == 1) {
+        worker();
+    } else {
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(worker);
+        }
+        for (auto& th : pool) {
+            th.join();
         }
     }
     
     return best;
 }
-
-
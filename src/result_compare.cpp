@@ -0,0 +1,279 @@
+// result_compare.cpp - Match two benchmark result CSVs and flag performance regressions
+#include <vector>
+#include <string>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cmath>
+#include <cstdlib>
+
+#ifndef RESULT_COMPARE_HPP
+#define RESULT_COMPARE_HPP
+
+/**
+ * Timing and outcome of one (dataset, algorithm) pair in a results file
+ *
+ * Built from the rows for that pair: one row per run in
+ * benchmark_runs_*.csv and benchmark_all_*.csv, or a row summarizing
+ * --repeat runs (Runs, TimeMean, TimeStddev) in benchmark_detailed_*.csv.
+ * Rows are merged with the parallel variance formula, so either kind works.
+ */
+struct ResultSeries {
+    int runs = 0;         // Finished runs behind mean and stddev
+    double mean = 0.0;    // Mean time of the finished runs (s)
+    double m2 = 0.0;      // Sum of squared deviations from mean
+    int best_size = 0;    // Largest clique of a finished run
+    int failed = 0;       // Rows that timed out, failed or were skipped
+    bool skipped = false;
+
+    double stddev() const { return runs > 1 ? std::sqrt(m2 / (runs - 1)) : 0.0; }
+    bool finished() const { return runs > 0 && failed == 0; }
+
+    /**
+     * Merge n finished runs with the given mean and sample stddev
+     */
+    void add_runs(int n, double run_mean, double run_stddev, int size);
+};
+
+typedef std::pair<std::string, std::string> ResultKey;  // Dataset, algorithm
+
+/**
+ * Load a results CSV written by this benchmark or its plotting scripts
+ *
+ * Columns are found by header name: Dataset (optional; algorithm_summary
+ * files have none and match only each other), Algorithm, CliqueSize or
+ * CliqueSize_max, Time(s) or Time(s)_mean, and Success or Status.
+ * Algorithm names are compared with '_' read as a space, as
+ * benchmark_all files write them.
+ * @return False (with error set) if the file cannot be read or lacks columns
+ */
+bool load_results(const std::string& filename, std::map<ResultKey, ResultSeries>& results,
+                  std::string& error);
+
+/**
+ * Thresholds for compare_results
+ */
+struct CompareOptions {
+    double max_slowdown = 0.05;  // Slowdowns below this fraction are never flagged
+};
+
+/**
+ * One pair present in both files
+ */
+struct ResultComparison {
+    ResultKey key;
+    ResultSeries baseline;
+    ResultSeries current;
+    double change = 0.0;        // current / baseline mean time - 1
+    bool tested = false;        // Both sides have at least two runs
+    double t = 0.0;             // Welch's t statistic of the slowdown
+    bool slower = false;        // Significant slowdown beyond max_slowdown
+    bool faster = false;        // Significant speedup beyond max_slowdown
+    bool smaller = false;       // Best clique shrank
+    bool stopped = false;       // Finished in the baseline, not any more
+
+    bool regression() const { return slower || smaller || stopped; }
+};
+
+/**
+ * Compare every pair present in both files
+ *
+ * A slowdown is flagged when the mean grew by more than max_slowdown and
+ * a one-sided Welch's t-test rejects equal means at the 5% level. Pairs
+ * with a single run on either side cannot be tested and are never
+ * flagged as slower. A smaller best clique, or a pair that no longer
+ * finishes (timeout, failure, skip), is always a regression.
+ * @param only_baseline Output: pairs missing from current
+ * @param only_current Output: pairs missing from baseline
+ */
+std::vector<ResultComparison> compare_results(const std::map<ResultKey, ResultSeries>& baseline,
+                                              const std::map<ResultKey, ResultSeries>& current,
+                                              const CompareOptions& options,
+                                              std::vector<ResultKey>& only_baseline,
+                                              std::vector<ResultKey>& only_current);
+
+#endif // RESULT_COMPARE_HPP
+
+
+void ResultSeries::add_runs(int n, double run_mean, double run_stddev, int size) {
+    if (n <= 0) return;
+    double run_m2 = run_stddev * run_stddev * (n - 1);
+    int total = runs + n;
+    double delta = run_mean - mean;
+    mean += delta * n / total;
+    m2 += run_m2 + delta * delta * runs * n / total;
+    runs = total;
+    best_size = std::max(best_size, size);
+}
+
+static std::vector<std::string> split_csv_line(const std::string& line) {
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream iss(line);
+    while (std::getline(iss, field, ',')) {
+        if (!field.empty() && field.back() == '\r') field.pop_back();
+        fields.push_back(field);
+    }
+    if (!line.empty() && line.back() == ',') fields.push_back("");
+    return fields;
+}
+
+// Parse a whole field as a number; N/A and empty fields are not numbers
+static bool parse_number(const std::string& field, double& value) {
+    if (field.empty()) return false;
+    char* end = nullptr;
+    value = std::strtod(field.c_str(), &end);
+    return *end == '\0' && std::isfinite(value);
+}
+
+bool load_results(const std::string& filename, std::map<ResultKey, ResultSeries>& results,
+                  std::string& error) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        error = "Cannot open " + filename;
+        return false;
+    }
+    std::string line;
+    if (!std::getline(file, line)) {
+        error = filename + " is empty";
+        return false;
+    }
+
+    std::map<std::string, int> columns;
+    std::vector<std::string> header = split_csv_line(line);
+    for (size_t i = 0; i < header.size(); i++) {
+        columns[header[i]] = (int)i;
+    }
+    auto column = [&](const char* a, const char* b) {
+        auto it = columns.find(a);
+        if (it == columns.end() && b) it = columns.find(b);
+        return it == columns.end() ? -1 : it->second;
+    };
+    int dataset_col = column("Dataset", nullptr);
+    int algorithm_col = column("Algorithm", nullptr);
+    int size_col = column("CliqueSize", "CliqueSize_max");
+    int time_col = column("Time(s)", "Time(s)_mean");
+    int success_col = column("Success", nullptr);
+    int status_col = column("Status", nullptr);
+    int runs_col = column("Runs", nullptr);
+    int mean_col = column("TimeMean", nullptr);
+    int stddev_col = column("TimeStddev", nullptr);
+    if (algorithm_col < 0 || size_col < 0 || time_col < 0) {
+        error = filename + ": needs Algorithm, CliqueSize and Time(s) columns";
+        return false;
+    }
+
+    int line_number = 1;
+    while (std::getline(file, line)) {
+        line_number++;
+        if (line.empty()) continue;
+        std::vector<std::string> fields = split_csv_line(line);
+        if (fields.size() < header.size()) {
+            error = filename + ":" + std::to_string(line_number) + ": expected " +
+                    std::to_string(header.size()) + " fields";
+            return false;
+        }
+
+        ResultKey key(dataset_col >= 0 ? fields[dataset_col] : "", fields[algorithm_col]);
+        std::replace(key.second.begin(), key.second.end(), '_', ' ');
+        ResultSeries& series = results[key];
+
+        std::string status = status_col >= 0 ? fields[status_col] : "";
+        bool finished;
+        if (success_col >= 0) {
+            std::string success = fields[success_col];
+            std::transform(success.begin(), success.end(), success.begin(), ::tolower);
+            finished = success == "true";
+        } else {
+            finished = status_col < 0 || status == "OK";
+        }
+        double time, size;
+        if (!finished || !parse_number(fields[time_col], time) ||
+            !parse_number(fields[size_col], size)) {
+            series.failed++;
+            series.skipped = series.skipped || status == "SKIPPED";
+            continue;
+        }
+
+        // A row of benchmark_detailed_*.csv can stand for --repeat runs
+        double runs = 1, mean = time, stddev = 0;
+        if (runs_col >= 0 && mean_col >= 0 && stddev_col >= 0 &&
+            parse_number(fields[runs_col], runs) && runs > 1 &&
+            parse_number(fields[mean_col], mean) && parse_number(fields[stddev_col], stddev)) {
+            series.add_runs((int)runs, mean, stddev, (int)size);
+        } else {
+            series.add_runs(1, time, 0.0, (int)size);
+        }
+    }
+    return true;
+}
+
+// One-sided 95% quantile of Student's t distribution, rounded down to a tabulated df
+static double t_critical_95(double df) {
+    static const double table[30] = {
+        6.314, 2.920, 2.353, 2.132, 2.015, 1.943, 1.895, 1.860, 1.833, 1.812,
+        1.796, 1.782, 1.771, 1.761, 1.753, 1.746, 1.740, 1.734, 1.729, 1.725,
+        1.721, 1.717, 1.714, 1.711, 1.708, 1.706, 1.703, 1.701, 1.699, 1.697
+    };
+    if (df < 1) return table[0];
+    if (df < 31) return table[(int)df - 1];
+    if (df < 60) return 1.684;
+    if (df < 120) return 1.671;
+    return 1.658;
+}
+
+std::vector<ResultComparison> compare_results(const std::map<ResultKey, ResultSeries>& baseline,
+                                              const std::map<ResultKey, ResultSeries>& current,
+                                              const CompareOptions& options,
+                                              std::vector<ResultKey>& only_baseline,
+                                              std::vector<ResultKey>& only_current) {
+    std::vector<ResultComparison> comparisons;
+    for (const auto& [key, base] : baseline) {
+        auto it = current.find(key);
+        if (it == current.end()) {
+            only_baseline.push_back(key);
+            continue;
+        }
+        ResultComparison c;
+        c.key = key;
+        c.baseline = base;
+        c.current = it->second;
+        const ResultSeries& now = c.current;
+
+        if (base.finished() && !now.finished()) {
+            c.stopped = true;
+        }
+        if (base.runs > 0 && now.runs > 0) {
+            c.smaller = now.best_size < base.best_size && base.finished() && now.finished();
+            c.change = base.mean > 0 ? now.mean / base.mean - 1.0 : 0.0;
+
+            // Welch's t-test; identical repeated times leave no variance to test against
+            c.tested = base.runs > 1 && now.runs > 1;
+            if (c.tested) {
+                double vb = base.stddev() * base.stddev() / base.runs;
+                double vn = now.stddev() * now.stddev() / now.runs;
+                double se = std::sqrt(vb + vn);
+                bool significant;
+                if (se > 0) {
+                    c.t = (now.mean - base.mean) / se;
+                    double df = (vb + vn) * (vb + vn) /
+                                (vb * vb / (base.runs - 1) + vn * vn / (now.runs - 1));
+                    significant = std::fabs(c.t) > t_critical_95(df);
+                } else {
+                    significant = now.mean != base.mean;
+                }
+                c.slower = significant && c.change > options.max_slowdown;
+                c.faster = significant && c.change < -options.max_slowdown;
+            }
+        }
+        comparisons.push_back(c);
+    }
+    for (const auto& entry : current) {
+        if (baseline.find(entry.first) == baseline.end()) {
+            only_current.push_back(entry.first);
+        }
+    }
+    return comparisons;
+}
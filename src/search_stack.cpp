@@ -0,0 +1,136 @@
+// search_stack.cpp - Explicit-stack driver for depth-first clique search
+#include <vector>
+#include <cstddef>
+#include <chrono>
+
+#ifndef SEARCH_STACK_HPP
+#define SEARCH_STACK_HPP
+
+/**
+ * Cooperative wall-clock limit for exact searches
+ *
+ * Solvers check expired() between slices of work, stop with their
+ * incumbent intact, and report timed_out(). A clock read per slice of a
+ * few hundred nodes costs nothing measurable.
+ */
+class SearchDeadline {
+public:
+    /**
+     * Start the clock
+     * @param seconds Time limit (0 = none)
+     */
+    void start(double seconds) {
+        limited = seconds > 0.0;
+        end = std::chrono::steady_clock::now() +
+              std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  std::chrono::duration<double>(seconds));
+    }
+
+    bool active() const { return limited; }
+
+    bool expired() const {
+        return limited && std::chrono::steady_clock::now() >= end;
+    }
+
+private:
+    bool limited = false;
+    std::chrono::steady_clock::time_point end;
+};
+
+/**
+ * Explicit stack of search frames for depth-first branch-and-bound
+ *
+ * Exact solvers keep their search state here instead of on the call
+ * stack, so deep searches on large sparse graphs cannot exhaust it.
+ * Frames live in one contiguous vector that only grows: a frame popped
+ * at depth d keeps its buffers, and the next push at depth d reuses them
+ * without allocating.
+ *
+ * Because the whole search is data, it can be:
+ * - suspended: run() returns after a step budget with the stack intact
+ * - resumed: call run() again on the same stack
+ * - time-limited: run_until() suspends once a SearchDeadline passes
+ *
+ * Solvers remove a branch from the frame's candidate state when they push
+ * its child, so a frame always reflects the branches already taken.
+ */
+template<typename Frame>
+class SearchStack {
+public:
+    /**
+     * Push a frame and return it for the caller to fill in
+     * May grow the stack, which invalidates references to other frames;
+     * refetch them by depth afterwards.
+     */
+    Frame& push() {
+        if (top == frames.size()) {
+            frames.emplace_back();
+        }
+        return frames[top++];
+    }
+
+    void pop() { top--; }
+
+    Frame& back() { return frames[top - 1]; }
+
+    Frame& operator[](size_t depth) { return frames[depth]; }
+    const Frame& operator[](size_t depth) const { return frames[depth]; }
+
+    /**
+     * Number of frames currently on the stack
+     */
+    size_t depth() const { return top; }
+
+    bool empty() const { return top == 0; }
+
+    /**
+     * Drop every frame (buffers are kept for reuse)
+     */
+    void clear() { top = 0; }
+
+    /**
+     * Run step(stack) until the stack is empty or max_steps is reached
+     * @param step Callable doing one unit of work on back(): push a child or pop
+     * @param max_steps Step budget (-1 = unlimited)
+     * @return true if the search finished, false if suspended
+     */
+    template<typename Step>
+    bool run(Step step, long long max_steps = -1) {
+        while (top > 0) {
+            if (max_steps == 0) {
+                return false;
+            }
+            if (max_steps > 0) {
+                max_steps--;
+            }
+            step(*this);
+        }
+        return true;
+    }
+
+    /**
+     * Run step(stack) until the stack is empty or the deadline passes
+     * @param step Callable doing one unit of work on back(): push a child or pop
+     * @param deadline Checked every slice steps
+     * @param slice Steps between clock reads
+     * @return true if the search finished, false if the deadline stopped it
+     */
+    template<typename Step>
+    bool run_until(Step step, const SearchDeadline& deadline, long long slice = 256) {
+        if (!deadline.active()) {
+            return run(step);
+        }
+        while (!run(step, slice)) {
+            if (deadline.expired()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::vector<Frame> frames;
+    size_t top = 0;
+};
+
+#endif // SEARCH_STACK_HPP
@@ -0,0 +1,138 @@
+// search_stats.cpp - Search-tree instrumentation shared by the exact solvers
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#ifndef SEARCH_STATS_HPP
+#define SEARCH_STATS_HPP
+
+/**
+ * Shape of one branch-and-bound search tree
+ */
+struct SearchStats {
+    /**
+     * The incumbent grew at this point of the search
+     */
+    struct IncumbentUpdate {
+        double seconds;   // Since the search started
+        int size;         // New incumbent size
+        long long node;   // Nodes explored by the recording thread so far
+    };
+
+    long long nodes = 0;
+    int max_depth = 0;
+    std::vector<long long> depth_histogram;  // Nodes entered at each depth (clique size at the node)
+    long long size_prunes = 0;      // Cut by |C| + |P| <= best
+    long long coloring_prunes = 0;  // Cut by |C| + colors <= best
+    long long suffix_prunes = 0;    // Cut by |C| + c[j] <= best (Östergård's suffix table)
+    long long leaves = 0;           // Nodes with no candidates left
+    std::vector<IncumbentUpdate> incumbent_updates;
+};
+
+/**
+ * Collects SearchStats when compiled with -DSEARCH_STATS
+ *
+ * Without the flag every method is an empty inline function and the
+ * recorder has no data members, so solvers call it unconditionally and
+ * release builds pay nothing. Parallel solvers give each worker its own
+ * recorder started from the solver's clock and merge them at the end.
+ */
+class SearchStatsRecorder {
+public:
+    static constexpr bool enabled() {
+#ifdef SEARCH_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+#ifdef SEARCH_STATS
+    /**
+     * Clear all counters and start the clock for incumbent timestamps
+     */
+    void start() {
+        start(std::chrono::steady_clock::now());
+    }
+
+    /**
+     * Clear all counters, sharing the clock of another recorder
+     */
+    void start(const SearchStatsRecorder& clock) {
+        start(clock.started);
+    }
+
+    void node(size_t depth) {
+        s.nodes++;
+        if (depth >= s.depth_histogram.size()) {
+            s.depth_histogram.resize(depth + 1, 0);
+        }
+        s.depth_histogram[depth]++;
+        s.max_depth = std::max(s.max_depth, (int)depth);
+    }
+
+    void leaf() { s.leaves++; }
+    void size_prune() { s.size_prunes++; }
+    void coloring_prune() { s.coloring_prunes++; }
+    void suffix_prune() { s.suffix_prunes++; }
+
+    void incumbent(size_t size) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - started;
+        s.incumbent_updates.push_back({elapsed.count(), (int)size, s.nodes});
+    }
+
+    /**
+     * Add another recorder's counters (incumbent updates stay in time order)
+     */
+    void merge(const SearchStatsRecorder& other) {
+        const SearchStats& o = other.s;
+        s.nodes += o.nodes;
+        s.max_depth = std::max(s.max_depth, o.max_depth);
+        if (o.depth_histogram.size() > s.depth_histogram.size()) {
+            s.depth_histogram.resize(o.depth_histogram.size(), 0);
+        }
+        for (size_t d = 0; d < o.depth_histogram.size(); d++) {
+            s.depth_histogram[d] += o.depth_histogram[d];
+        }
+        s.size_prunes += o.size_prunes;
+        s.coloring_prunes += o.coloring_prunes;
+        s.suffix_prunes += o.suffix_prunes;
+        s.leaves += o.leaves;
+        s.incumbent_updates.insert(s.incumbent_updates.end(),
+                                   o.incumbent_updates.begin(), o.incumbent_updates.end());
+        std::stable_sort(s.incumbent_updates.begin(), s.incumbent_updates.end(),
+                         [](const SearchStats::IncumbentUpdate& a,
+                            const SearchStats::IncumbentUpdate& b) {
+                             return a.seconds < b.seconds;
+                         });
+    }
+
+    const SearchStats& stats() const { return s; }
+
+private:
+    SearchStats s;
+    std::chrono::steady_clock::time_point started;
+
+    void start(std::chrono::steady_clock::time_point t) {
+        s = SearchStats();
+        started = t;
+    }
+#else
+    void start() {}
+    void start(const SearchStatsRecorder&) {}
+    void node(size_t) {}
+    void leaf() {}
+    void size_prune() {}
+    void coloring_prune() {}
+    void suffix_prune() {}
+    void incumbent(size_t) {}
+    void merge(const SearchStatsRecorder&) {}
+
+    const SearchStats& stats() const {
+        static const SearchStats empty;
+        return empty;
+    }
+#endif
+};
+
+#endif // SEARCH_STATS_HPP
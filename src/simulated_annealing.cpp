@@ -3,27 +3,40 @@
 #include <random>
 #include <cmath>
 #include <algorithm>
-#include <unordered_set>
-#include <unordered_map>
-#include <set>
 #include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 /**
  * Simulated Annealing metaheuristic for maximum clique problem
  * 
  * Algorithm:
  * 1. Start with initial solution (greedy clique)
- * 2. Iteratively generate neighbor solutions by:
+ * 2. Iteratively propose a move:
  *    - Adding a vertex that can extend the clique
  *    - Removing a vertex from the clique
- *    - Swapping a vertex (remove one, add another)
+ *    - Swapping a vertex in for the one member it is not adjacent to
  * 3. Accept better solutions always
  * 4. Accept worse solutions with probability exp(-ΔE/T)
  * 5. Gradually decrease temperature T
  * 6. Return best solution found
  * 
- * Time complexity: O(max_iterations * V²) in worst case
- * Space complexity: O(V)
+ * The clique is kept in a CliqueState, whose add and swap candidate sets
+ * are updated incrementally. Proposing a move is O(1), applying one is
+ * O(deg), and every state is a clique by construction.
+ * 
+ * Parallel tempering mode (find_clique_tempering):
+ * - R replicas run at fixed temperatures on a geometric ladder, one
+ *   thread each, so hot chains explore while cold chains refine
+ * - Every EXCHANGE_INTERVAL steps, adjacent temperatures try to swap
+ *   states with probability min(1, exp((1/T_i - 1/T_j)(E_i - E_j))),
+ *   E = -|clique|, alternating even and odd pairs
+ * - The best clique over all replicas is kept
+ * 
+ * Time complexity: O(max_iterations * Δ), Δ = maximum degree
+ * Space complexity: O(V), O(R * V) for parallel tempering
  * 
  * Parameters:
  * - initial_temp: Starting temperature (default 100.0)
@@ -51,28 +64,62 @@ public:
      */
     std::vector<int> find_clique(const Graph& g);
     
+    /**
+     * Find maximum clique with parallel tempering (replica exchange)
+     * Each replica runs max_iterations steps unless a time limit is set.
+     * @param g Input graph
+     * @param num_replicas Chains, one thread each (0 = hardware_concurrency, at least 2)
+     * @param time_limit Wall-clock budget in seconds (0 = use max_iterations)
+     * @return Vector of vertex IDs forming the best clique found
+     */
+    std::vector<int> find_clique_tempering(const Graph& g, int num_replicas = 0,
+                                           double time_limit = 0.0);
+    
 private:
+    // Temperature ladder for parallel tempering. Moves change |C| by at
+    // most 1, so T much above 2 accepts almost everything.
+    static constexpr double TEMPERING_MIN_TEMP = 0.05;
+    static constexpr double TEMPERING_MAX_TEMP = 2.0;
+    static constexpr int EXCHANGE_INTERVAL = 1000;  // Steps between exchanges
+    
     double temperature;
     double initial_temperature;
     double cooling_rate;
     int max_iterations;
     std::mt19937 rng;
     
+    enum MoveType {
+        REMOVE,  // Drop a member (size - 1)
+        ADD,     // Add an add candidate (size + 1)
+        SWAP,    // Swap in a swap candidate (same size)
+        NONE     // Chosen move has no candidate
+    };
+    
+    struct Move {
+        MoveType type;
+        int vertex;
+    };
+    
     /**
-     * Generate a neighbor solution by random modification
-     * @param current Current clique
-     * @param g Input graph
-     * @return New candidate clique
+     * Pick a random move from the current state
+     * @param state Current clique with candidate sets
+     * @param gen Random generator of the calling chain
+     * @return Move to evaluate
      */
-    std::vector<int> generate_neighbor(const std::vector<int>& current, const Graph& g);
+    Move generate_move(const CliqueState& state, std::mt19937& gen);
     
     /**
-     * Check if given vertices form a valid clique
-     * @param clique Candidate clique
-     * @param g Input graph
-     * @return true if valid clique
+     * Apply an accepted move
      */
-    bool is_valid_clique(const std::vector<int>& clique, const Graph& g);
+    void apply_move(CliqueState& state, const Move& move);
+    
+    /**
+     * One Metropolis step: propose a move and apply it if accepted
+     * @param state Current clique
+     * @param temp Temperature
+     * @param gen Random generator of the calling chain
+     */
+    void anneal_step(CliqueState& state, double temp, std::mt19937& gen);
 };
 
 
@@ -88,132 +135,229 @@ SimulatedAnnealing::SimulatedAnnealing(double initial_temp, double cooling_rate,
     }
 }
 
-bool SimulatedAnnealing::is_valid_clique(const std::vector<int>& clique, const Graph& g) {
-    return g.is_clique(clique);
+SimulatedAnnealing::Move SimulatedAnnealing::generate_move(const CliqueState& state,
+                                                          std::mt19937& gen) {
+    std::uniform_int_distribution<int> op_dist(0, 2);
+    int operation = op_dist(gen);
+    
+    const VertexSet* from = nullptr;
+    MoveType type = NONE;
+    if (operation == 0) {
+        // Remove a random vertex
+        from = &state.clique();
+        type = REMOVE;
+    } else if (operation == 1) {
+        // Add a vertex that's connected to all current vertices
+        from = &state.add_candidates();
+        type = ADD;
+    } else {
+        // Swap in a vertex that misses exactly one current vertex
+        from = &state.swap_candidates();
+        type = SWAP;
+    }
+    
+    if (from->empty()) {
+        return {NONE, -1};
+    }
+    
+    std::uniform_int_distribution<int> idx_dist(0, from->size() - 1);
+    return {type, (*from)[idx_dist(gen)]};
 }
 
-std::vector<int> SimulatedAnnealing::generate_neighbor(const std::vector<int>& current, 
-                                                        const Graph& g) {
-    std::vector<int> neighbor = current;
-    std::uniform_int_distribution<int> op_dist(0, 2);
-    int operation = op_dist(rng);
+void SimulatedAnnealing::apply_move(CliqueState& state, const Move& move) {
+    switch (move.type) {
+        case REMOVE:
+            state.remove(move.vertex);
+            break;
+        case ADD:
+            state.add(move.vertex);
+            break;
+        case SWAP:
+            state.swap_in(move.vertex);
+            break;
+        default:
+            break;
+    }
+}
+
+void SimulatedAnnealing::anneal_step(CliqueState& state, double temp, std::mt19937& gen) {
+    std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
     
-    int n = g.num_vertices();
+    // Propose a move; every move yields a clique
+    Move move = generate_move(state, gen);
     
-    // Create set of current clique vertices for fast lookup
-    std::unordered_set<int> current_set(current.begin(), current.end());
+    // Calculate energy difference (negative because we want to maximize)
+    int delta_E = (move.type == REMOVE) ? 1 : (move.type == ADD) ? -1 : 0;
     
-    if (operation == 0 && !neighbor.empty()) {
-        // Remove a random vertex
-        std::uniform_int_distribution<int> idx_dist(0, neighbor.size() - 1);
-        int remove_idx = idx_dist(rng);
-        neighbor.erase(neighbor.begin() + remove_idx);
-    } 
-    else if (operation == 1) {
-        // Try to add a vertex that's connected to all current vertices
-        std::vector<int> candidates;
-        for (int v = 0; v < n; v++) {
-            if (current_set.find(v) == current_set.end()) {
-                bool can_add = true;
-                for (int u : current) {
-                    if (!g.has_edge(v, u)) {
-                        can_add = false;
-                        break;
-                    }
-                }
-                if (can_add) {
-                    candidates.push_back(v);
-                }
-            }
-        }
-        
-        if (!candidates.empty()) {
-            std::uniform_int_distribution<int> cand_dist(0, candidates.size() - 1);
-            neighbor.push_back(candidates[cand_dist(rng)]);
-        }
-    } 
-    else if (operation == 2 && !neighbor.empty()) {
-        // Swap: remove one vertex and add another
-        std::uniform_int_distribution<int> idx_dist(0, neighbor.size() - 1);
-        int remove_idx = idx_dist(rng);
-        int removed_vertex = neighbor[remove_idx];
-        neighbor.erase(neighbor.begin() + remove_idx);
-        current_set.erase(removed_vertex);
-        
-        // Try to add a vertex
-        std::vector<int> candidates;
-        for (int v = 0; v < n; v++) {
-            if (current_set.find(v) == current_set.end()) {
-                bool can_add = true;
-                for (int u : neighbor) {
-                    if (!g.has_edge(v, u)) {
-                        can_add = false;
-                        break;
-                    }
-                }
-                if (can_add) {
-                    candidates.push_back(v);
-                }
-            }
-        }
-        
-        if (!candidates.empty()) {
-            std::uniform_int_distribution<int> cand_dist(0, candidates.size() - 1);
-            neighbor.push_back(candidates[cand_dist(rng)]);
-        }
+    // Accept better solutions always, worse solutions with probability
+    bool accept = false;
+    if (delta_E < 0) {
+        // Better solution (larger clique)
+        accept = true;
+    } else if (delta_E > 0 && temp > 0) {
+        // Worse solution - accept with probability
+        double acceptance_prob = std::exp(-delta_E / temp);
+        accept = (prob_dist(gen) < acceptance_prob);
+    } else {
+        // Same size
+        accept = (prob_dist(gen) < 0.5);
     }
     
-    return neighbor;
+    if (accept) {
+        apply_move(state, move);
+    }
 }
 
 std::vector<int> SimulatedAnnealing::find_clique(const Graph& g) {
     // Start with greedy solution
-    std::vector<int> current = GreedyClique::find_clique(g);
-    std::vector<int> best = current;
+    std::vector<int> best = GreedyClique::find_clique(g);
+    CliqueState current;
+    current.assign(g, best);
     
     temperature = initial_temperature;
-    std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
     
     for (int iter = 0; iter < max_iterations; iter++) {
-        // Generate neighbor solution
-        std::vector<int> neighbor = generate_neighbor(current, g);
+        anneal_step(current, temperature, rng);
+        
+        // Update best solution
+        if (current.size() > (int)best.size()) {
+            best = current.clique().elements();
+        }
         
-        // Validate neighbor is a clique
-        if (!is_valid_clique(neighbor, g)) {
-            continue;
+        // Cool down
+        temperature *= cooling_rate;
+    }
+    
+    return best;
+}
+
+std::vector<int> SimulatedAnnealing::find_clique_tempering(const Graph& g, int num_replicas,
+                                                           double time_limit) {
+    int R = num_replicas;
+    if (R <= 0) {
+        R = std::max(2u, std::thread::hardware_concurrency());
+    }
+    
+    std::vector<int> greedy = GreedyClique::find_clique(g);
+    
+    // Geometric ladder: temps[0] coldest, temps[R-1] hottest
+    std::vector<double> temps(R);
+    for (int k = 0; k < R; k++) {
+        double t = (R == 1) ? 0.0 : (double)k / (R - 1);
+        temps[k] = TEMPERING_MIN_TEMP * std::pow(TEMPERING_MAX_TEMP / TEMPERING_MIN_TEMP, t);
+    }
+    
+    // Per-replica state, each seeded from the master generator
+    std::vector<CliqueState> states(R);
+    std::vector<std::mt19937> gens(R);
+    std::vector<std::vector<int>> replica_best(R, greedy);
+    for (int r = 0; r < R; r++) {
+        states[r].assign(g, greedy);
+        gens[r].seed(rng());
+    }
+    
+    // replica_at[k] = replica currently at temperature k
+    std::vector<int> replica_at(R);
+    for (int k = 0; k < R; k++) {
+        replica_at[k] = k;
+    }
+    
+    std::vector<int> best = greedy;
+    std::uniform_real_distribution<double> prob_dist(0.0, 1.0);
+    auto start = std::chrono::steady_clock::now();
+    long long steps_done = 0;
+    
+    // Run temperature k for one interval
+    int steps = 0;
+    auto run_chain = [&](int k) {
+        int r = replica_at[k];
+        for (int s = 0; s < steps; s++) {
+            anneal_step(states[r], temps[k], gens[r]);
+            if (states[r].size() > (int)replica_best[r].size()) {
+                replica_best[r] = states[r].clique().elements();
+            }
+        }
+    };
+    
+    // Temperatures 1..R-1 each keep one thread for the whole run. This
+    // thread runs temperature 0, then does the exchanges while the others
+    // wait for the next round.
+    std::mutex mutex;
+    std::condition_variable round_started, round_finished;
+    long long round_id = 0;  // Rounds started so far
+    int running = 0;         // Pool threads still in the current round
+    bool done = false;
+    std::vector<std::thread> pool;
+    for (int k = 1; k < R; k++) {
+        pool.emplace_back([&, k]() {
+            long long seen = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    round_started.wait(lock, [&]() { return done || round_id > seen; });
+                    if (done) return;
+                    seen = round_id;
+                }
+                run_chain(k);
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--running == 0) round_finished.notify_one();
+            }
+        });
+    }
+    
+    for (int round = 0; ; round++) {
+        if (time_limit > 0) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed.count() >= time_limit) break;
+        } else if (steps_done >= max_iterations) {
+            break;
         }
         
-        // Calculate energy difference (negative because we want to maximize)
-        int delta_E = current.size() - neighbor.size();
+        steps = EXCHANGE_INTERVAL;
+        if (time_limit <= 0) {
+            steps = std::min<long long>(steps, max_iterations - steps_done);
+        }
         
-        // Accept better solutions always, worse solutions with probability
-        bool accept = false;
-        if (delta_E < 0) {
-            // Better solution (larger clique)
-            accept = true;
-        } else if (delta_E > 0 && temperature > 0) {
-            // Worse solution - accept with probability
-            double acceptance_prob = std::exp(-delta_E / temperature);
-            accept = (prob_dist(rng) < acceptance_prob);
-        } else {
-            // Same size
-            accept = (prob_dist(rng) < 0.5);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            round_id++;
+            running = R - 1;
+        }
+        round_started.notify_all();
+        run_chain(0);
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            round_finished.wait(lock, [&]() { return running == 0; });
         }
+        steps_done += steps;
         
-        if (accept) {
-            current = neighbor;
-            
-            // Update best solution
-            if (current.size() > best.size()) {
-                best = current;
+        // Share the global best
+        for (int r = 0; r < R; r++) {
+            if (replica_best[r].size() > best.size()) {
+                best = replica_best[r];
             }
         }
         
-        // Cool down
-        temperature *= cooling_rate;
+        // Replica exchange between adjacent temperatures (even/odd pairs alternate)
+        for (int k = round % 2; k + 1 < R; k += 2) {
+            int a = replica_at[k];
+            int b = replica_at[k + 1];
+            double energy_a = -states[a].size();
+            double energy_b = -states[b].size();
+            double exponent = (1.0 / temps[k] - 1.0 / temps[k + 1]) * (energy_a - energy_b);
+            if (exponent >= 0 || prob_dist(rng) < std::exp(exponent)) {
+                std::swap(replica_at[k], replica_at[k + 1]);
+            }
+        }
     }
     
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+    }
+    round_started.notify_all();
+    for (auto& th : pool) {
+        th.join();
+    }
     return best;
 }
-
-
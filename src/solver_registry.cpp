@@ -0,0 +1,408 @@
+// solver_registry.cpp - Every clique solver behind one name-and-options interface
+#include <vector>
+#include <string>
+#include <map>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+#include <cctype>
+
+#ifndef SOLVER_REGISTRY_HPP
+#define SOLVER_REGISTRY_HPP
+
+/**
+ * Named solver options, stored as text and parsed on access
+ *
+ * Options come from the command line as "key=value" pairs. Getters throw
+ * std::invalid_argument naming the option if a value does not parse, and
+ * std::out_of_range if the option is missing; SolverInfo::run fills in
+ * every declared default first, so solvers never see a missing key.
+ */
+class SolverOptions {
+public:
+    void set(const std::string& key, const std::string& value) { values[key] = value; }
+    bool has(const std::string& key) const { return values.count(key) > 0; }
+
+    std::string get_string(const std::string& key) const;
+    long long get_long(const std::string& key) const;
+    int get_int(const std::string& key) const { return (int)get_long(key); }
+    double get_double(const std::string& key) const;
+
+    /**
+     * Add "key=value[,key=value...]" pairs
+     * @return False (with error set) on a pair without '='
+     */
+    bool parse(const std::string& spec, std::string& error);
+
+    const std::map<std::string, std::string>& all() const { return values; }
+
+private:
+    std::map<std::string, std::string> values;
+};
+
+/**
+ * What one solver call found
+ */
+struct SolverOutput {
+    std::vector<int> clique;
+    bool timed_out = false;  // Exact solver stopped by its time_limit option
+    long long nodes = -1;    // Search nodes (-1 = heuristic)
+    SearchStats search;      // Filled for exact solvers built with -DSEARCH_STATS
+};
+
+/**
+ * An option a solver reads, with the value used when none is given
+ */
+struct SolverOptionSpec {
+    std::string key;
+    std::string default_value;
+    std::string description;
+};
+
+/**
+ * One registered solver
+ */
+struct SolverInfo {
+    std::string name;         // Result and skip-rule name, e.g. "Degeneracy BK"
+    std::string title;        // Progress label, e.g. "Degeneracy Bron-Kerbosch"
+    bool exact;               // Proves optimality unless stopped by time_limit
+    bool runs_by_default;     // Part of the run when no --algo is given
+    std::vector<SolverOptionSpec> options;
+    std::function<SolverOutput(const Graph&, const SolverOptions&)> solve;
+
+    bool accepts(const std::string& key) const;
+
+    /**
+     * The option that sets how many threads it runs ("" = single-threaded)
+     */
+    std::string thread_option() const;
+
+    /**
+     * Solve g with the given options, defaults filled in
+     */
+    SolverOutput run(const Graph& g, const SolverOptions& given) const;
+};
+
+/**
+ * A solver picked for a run, with its option overrides
+ */
+struct SolverSelection {
+    const SolverInfo* solver;
+    SolverOptions options;
+};
+
+/**
+ * All solvers, in the order the benchmark runs them
+ */
+const std::vector<SolverInfo>& solver_registry();
+
+/**
+ * Look a solver up by name, ignoring case and any non-alphanumeric
+ * characters ("degeneracy_bk" finds "Degeneracy BK")
+ * @return nullptr if no solver matches
+ */
+const SolverInfo* find_solver(const std::string& name);
+
+/**
+ * Add the solvers named by spec to selection
+ *
+ * spec is NAME[:key=value[,key=value...]], or one of the groups "all",
+ * "exact", "heuristic" and "default". A group passes each solver only
+ * the options it accepts; every key must be accepted by some solver.
+ * @return False (with error set) on an unknown solver or option
+ */
+bool select_solvers(const std::string& spec, std::vector<SolverSelection>& selection,
+                    std::string& error);
+
+#endif // SOLVER_REGISTRY_HPP
+
+
+std::string SolverOptions::get_string(const std::string& key) const {
+    auto it = values.find(key);
+    if (it == values.end()) {
+        throw std::out_of_range("Missing option " + key);
+    }
+    return it->second;
+}
+
+long long SolverOptions::get_long(const std::string& key) const {
+    std::string value = get_string(key);
+    size_t used = 0;
+    long long result = 0;
+    try {
+        result = std::stoll(value, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != value.size()) {
+        throw std::invalid_argument("Option " + key + "=" + value + " is not an integer");
+    }
+    return result;
+}
+
+double SolverOptions::get_double(const std::string& key) const {
+    std::string value = get_string(key);
+    size_t used = 0;
+    double result = 0;
+    try {
+        result = std::stod(value, &used);
+    } catch (const std::exception&) {
+        used = 0;
+    }
+    if (used == 0 || used != value.size()) {
+        throw std::invalid_argument("Option " + key + "=" + value + " is not a number");
+    }
+    return result;
+}
+
+bool SolverOptions::parse(const std::string& spec, std::string& error) {
+    size_t start = 0;
+    while (start <= spec.size()) {
+        size_t end = spec.find(',', start);
+        if (end == std::string::npos) end = spec.size();
+        std::string pair = spec.substr(start, end - start);
+        size_t eq = pair.find('=');
+        if (eq == std::string::npos || eq == 0) {
+            error = "Expected key=value, got '" + pair + "'";
+            return false;
+        }
+        set(pair.substr(0, eq), pair.substr(eq + 1));
+        start = end + 1;
+    }
+    return true;
+}
+
+bool SolverInfo::accepts(const std::string& key) const {
+    for (const auto& spec : options) {
+        if (spec.key == key) return true;
+    }
+    return false;
+}
+
+std::string SolverInfo::thread_option() const {
+    if (accepts("threads")) return "threads";
+    if (accepts("replicas")) return "replicas";
+    return "";
+}
+
+SolverOutput SolverInfo::run(const Graph& g, const SolverOptions& given) const {
+    SolverOptions all = given;
+    for (const auto& spec : options) {
+        if (!all.has(spec.key)) all.set(spec.key, spec.default_value);
+    }
+    return solve(g, all);
+}
+
+// Options shared by several solvers
+static SolverOptionSpec seed_option() {
+    return {"seed", "0", "Random seed (0 = random; the benchmark passes --seed + run)"};
+}
+
+static SolverOptionSpec threads_option() {
+    return {"threads", "0", "Worker threads (0 = hardware concurrency)"};
+}
+
+static SolverOptionSpec time_limit_option() {
+    return {"time_limit", "0", "Wall-clock limit in seconds (0 = none; default --timeout)"};
+}
+
+static SolverOutput heuristic_output(std::vector<int> clique) {
+    SolverOutput out;
+    out.clique = std::move(clique);
+    return out;
+}
+
+// Run an exact solver with its time limit and collect its counters
+template<typename Solver, typename Solve>
+static SolverOutput run_exact(Solver& solver, const SolverOptions& o, Solve solve) {
+    solver.set_time_limit(o.get_double("time_limit"));
+    SolverOutput out;
+    out.clique = solve(solver);
+    out.timed_out = solver.timed_out();
+    out.nodes = solver.get_nodes_explored();
+    if (SearchStatsRecorder::enabled()) {
+        out.search = solver.get_search_stats();
+    }
+    return out;
+}
+
+template<typename Solver>
+static SolverOutput run_exact(const Graph& g, Solver& solver, const SolverOptions& o) {
+    return run_exact(solver, o, [&g](Solver& s) { return s.find_maximum_clique(g); });
+}
+
+static BBMC::OrderingStyle bbmc_ordering(const std::string& name) {
+    if (name == "degree") return BBMC::DEGREE_ORDER;
+    if (name == "min_width") return BBMC::MIN_WIDTH_ORDER;
+    if (name == "mcr") return BBMC::MCR_ORDER;
+    throw std::invalid_argument("Option ordering=" + name + " is not degree, min_width or mcr");
+}
+
+const std::vector<SolverInfo>& solver_registry() {
+    static const std::vector<SolverInfo> solvers = {
+        {"Greedy", "Greedy Heuristic", false, true, {},
+         [](const Graph& g, const SolverOptions&) {
+             return heuristic_output(GreedyClique::find_clique(g));
+         }},
+        {"Randomized", "Randomized Heuristic", false, true,
+         {{"restarts", "10", "Random restarts"},
+          {"swaps", "1000", "Swap attempts per restart"},
+          seed_option(), threads_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             RandomizedHeuristic algo(o.get_int("restarts"), o.get_int("swaps"),
+                                      (unsigned int)o.get_long("seed"), o.get_int("threads"));
+             return heuristic_output(algo.find_clique(g));
+         }},
+        {"Simulated Annealing", "Simulated Annealing", false, true,
+         {{"initial_temp", "100", "Starting temperature"},
+          {"cooling_rate", "0.995", "Temperature multiplier per iteration"},
+          {"iterations", "100000", "Annealing steps"},
+          seed_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             SimulatedAnnealing algo(o.get_double("initial_temp"), o.get_double("cooling_rate"),
+                                     o.get_int("iterations"), (unsigned int)o.get_long("seed"));
+             return heuristic_output(algo.find_clique(g));
+         }},
+        {"Bron-Kerbosch", "Bron-Kerbosch (Vanilla)", true, true, {time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             BronKerbosch algo;
+             return run_exact(g, algo, o);
+         }},
+        {"Tomita", "Tomita (BK with Pivoting)", true, true, {time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             TomitaAlgorithm algo;
+             return run_exact(g, algo, o);
+         }},
+        {"Degeneracy BK", "Degeneracy Bron-Kerbosch", true, true,
+         {threads_option(), time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             DegeneracyBK algo(o.get_int("threads"));
+             return run_exact(g, algo, o);
+         }},
+        {"Ostergard", "Östergård", true, true, {time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             OstergardAlgorithm algo;
+             return run_exact(g, algo, o);
+         }},
+        {"BBMC", "BBMC", true, true,
+         {{"ordering", "degree", "Vertex ordering: degree, min_width or mcr"},
+          time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             BBMC algo(g, bbmc_ordering(o.get_string("ordering")));
+             return run_exact(algo, o, [](BBMC& s) { return s.find_maximum_clique(); });
+         }},
+        {"CPU Optimized", "CPU Optimized", true, true, {time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             CPUOptimized algo;
+             return run_exact(g, algo, o);
+         }},
+        {"MaxCliqueDyn", "MaxCliqueDyn (Tomita + Coloring)", true, true, {time_limit_option()},
+         [](const Graph& g, const SolverOptions& o) {
+             MaxCliqueDyn algo;
+             return run_exact(g, algo, o);
+         }},
+        {"Parallel Tempering", "Simulated Annealing (Parallel Tempering)", false, false,
+         {{"replicas", "0", "Chains, one thread each (0 = hardware concurrency, at least 2)"},
+          {"iterations", "100000", "Steps per chain when time_budget is 0"},
+          seed_option(),
+          // Not time_limit: --timeout would turn it into a run of the full timeout
+          {"time_budget", "0", "Run for this many seconds instead of iterations (0 = use iterations)"}},
+         [](const Graph& g, const SolverOptions& o) {
+             SimulatedAnnealing algo(100.0, 0.995, o.get_int("iterations"),
+                                     (unsigned int)o.get_long("seed"));
+             return heuristic_output(algo.find_clique_tempering(g, o.get_int("replicas"),
+                                                                o.get_double("time_budget")));
+         }},
+        {"DLS-MC", "Dynamic Local Search (DLS-MC)", false, false,
+         {{"penalty_delay", "2", "Local optima between penalty decreases"},
+          {"steps", "100000", "Add and swap moves"},
+          {"target", "0", "Stop at a clique of this size (0 = none)"},
+          seed_option(),
+          {"time_limit", "0", "Wall-clock budget in seconds (0 = none)"}},
+         [](const Graph& g, const SolverOptions& o) {
+             DynamicLocalSearch algo(o.get_int("penalty_delay"), o.get_long("steps"),
+                                     o.get_double("time_limit"), o.get_int("target"),
+                                     (unsigned int)o.get_long("seed"));
+             return heuristic_output(algo.find_clique(g));
+         }},
+        {"Tabu Search", "Tabu Search (MN/TS)", false, false,
+         {{"tenure", "7", "Base tabu tenure"},
+          {"iterations", "1000000", "Moves"},
+          {"max_unimproved", "4000", "Moves without a new best before restarting"},
+          {"target", "0", "Stop at a clique of this size (0 = none)"},
+          seed_option(),
+          {"time_limit", "0", "Wall-clock budget in seconds (0 = none)"}},
+         [](const Graph& g, const SolverOptions& o) {
+             TabuSearch algo(o.get_int("tenure"), o.get_long("iterations"),
+                             o.get_int("max_unimproved"), o.get_double("time_limit"),
+                             o.get_int("target"), (unsigned int)o.get_long("seed"));
+             return heuristic_output(algo.find_clique(g));
+         }},
+    };
+    return solvers;
+}
+
+// Lowercase letters and digits only
+static std::string solver_key(const std::string& name) {
+    std::string key;
+    for (unsigned char c : name) {
+        if (std::isalnum(c)) key += (char)std::tolower(c);
+    }
+    return key;
+}
+
+const SolverInfo* find_solver(const std::string& name) {
+    std::string key = solver_key(name);
+    for (const auto& solver : solver_registry()) {
+        if (solver_key(solver.name) == key) return &solver;
+    }
+    return nullptr;
+}
+
+bool select_solvers(const std::string& spec, std::vector<SolverSelection>& selection,
+                    std::string& error) {
+    size_t colon = spec.find(':');
+    std::string name = spec.substr(0, colon);
+
+    SolverOptions options;
+    if (colon != std::string::npos && !options.parse(spec.substr(colon + 1), error)) {
+        return false;
+    }
+
+    std::vector<const SolverInfo*> picked;
+    for (const auto& solver : solver_registry()) {
+        if (name == "all" || (name == "exact" && solver.exact) ||
+            (name == "heuristic" && !solver.exact) ||
+            (name == "default" && solver.runs_by_default)) {
+            picked.push_back(&solver);
+        }
+    }
+    if (picked.empty()) {
+        const SolverInfo* solver = find_solver(name);
+        if (!solver) {
+            error = "Unknown algorithm: " + name;
+            return false;
+        }
+        picked.push_back(solver);
+    }
+
+    // A group passes each solver the options it accepts; each key must fit one
+    for (const auto& [key, value] : options.all()) {
+        bool accepted = false;
+        for (const SolverInfo* solver : picked) {
+            accepted = accepted || solver->accepts(key);
+        }
+        if (!accepted) {
+            error = (picked.size() == 1 ? picked[0]->name : name) + " has no option " + key;
+            return false;
+        }
+    }
+    for (const SolverInfo* solver : picked) {
+        SolverSelection chosen{solver, SolverOptions()};
+        for (const auto& [key, value] : options.all()) {
+            if (solver->accepts(key)) chosen.options.set(key, value);
+        }
+        selection.push_back(chosen);
+    }
+    return true;
+}
@@ -0,0 +1,344 @@
+// tabu_search.cpp - Multi-neighborhood tabu search on a reduced CSR graph
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <chrono>
+
+#ifndef TABU_SEARCH_HPP
+#define TABU_SEARCH_HPP
+
+/**
+ * Compressed sparse row copy of an induced subgraph
+ *
+ * Vertices are relabeled to 0..k-1 and each neighbor list is one
+ * contiguous slice of adj, so walking a neighborhood touches no hash
+ * buckets. Adjacency tests go to the parent Graph's matrix.
+ *
+ * Space complexity: O(k + edges kept)
+ */
+class CSRGraph {
+public:
+    /**
+     * Contiguous neighbor list
+     */
+    struct Neighbors {
+        const int* first;
+        const int* last;
+        const int* begin() const { return first; }
+        const int* end() const { return last; }
+    };
+
+    /**
+     * Build the subgraph of g induced by vertices
+     * @param g Input graph (must outlive this graph)
+     * @param vertices Global vertex IDs; local ID i maps to vertices[i]
+     *
+     * Time complexity: O(V + sum of degrees of vertices)
+     */
+    void build(const Graph& g, const std::vector<int>& vertices);
+
+    int num_vertices() const { return ids.size(); }
+    int get_degree(int v) const { return offsets[v + 1] - offsets[v]; }
+    Neighbors get_neighbors(int v) const {
+        return {adj.data() + offsets[v], adj.data() + offsets[v + 1]};
+    }
+    bool has_edge(int u, int v) const { return graph->has_edge(ids[u], ids[v]); }
+
+    /**
+     * Global vertex ID of local vertex v
+     */
+    int global_id(int v) const { return ids[v]; }
+
+private:
+    const Graph* graph = nullptr;
+    std::vector<int> ids;
+    std::vector<int> offsets;  // Neighbors of v are adj[offsets[v] .. offsets[v+1])
+    std::vector<int> adj;
+};
+
+/**
+ * Tabu search for the maximum clique problem (multi-neighborhood, MN/TS)
+ *
+ * Algorithm:
+ * 1. Start from the multi-start greedy clique as incumbent
+ * 2. Reduce: drop vertices of degree < |best| until none is left (the
+ *    |best|-core); no other vertex is in a larger clique. An empty
+ *    core proves the incumbent optimal.
+ * 3. From a random vertex, repeat one move per iteration:
+ *    - ADD a non-tabu vertex adjacent to every member
+ *    - otherwise SWAP in a non-tabu vertex missing exactly one member
+ *    - otherwise DROP a random member
+ *    A vertex leaving the clique is tabu for tenure + rand(0..|swap set|)
+ *    iterations. An add that beats the incumbent ignores tabu status.
+ * 4. After max_unimproved iterations without a new best, clear the tabu
+ *    list and restart; if the incumbent grew, reduce the graph first
+ * 5. Stop at the iteration budget, time budget or target size
+ *
+ * Moves run on BasicCliqueState over the CSR graph, so each costs
+ * O(deg + candidates); nothing scans all vertices except restarts and
+ * reductions.
+ *
+ * Time complexity: O(max_iterations * (Δ + candidates)
+ *                  + restarts * (V + E)), Δ = maximum degree
+ * Space complexity: O(V + E)
+ *
+ * Reference: Wu, Hao (2012) "Multi-neighborhood tabu search for the
+ *            maximum weight clique problem"
+ */
+class TabuSearch {
+public:
+    /**
+     * Constructor with configurable parameters
+     * @param tenure Base tabu tenure for vertices leaving the clique
+     * @param max_iterations Maximum number of moves
+     * @param max_unimproved Moves without a new best before restarting
+     * @param time_limit Wall-clock budget in seconds (0 = none)
+     * @param target_size Stop once a clique of this size is found (0 = none)
+     * @param seed Random seed for reproducibility (0 for random)
+     */
+    TabuSearch(int tenure = 7, long long max_iterations = 1000000,
+               int max_unimproved = 4000, double time_limit = 0.0,
+               int target_size = 0, unsigned int seed = 0);
+
+    /**
+     * Find maximum clique using tabu search
+     * @param g Input graph
+     * @return Vector of vertex IDs forming the best clique found
+     */
+    std::vector<int> find_clique(const Graph& g);
+
+    /**
+     * Whether the last find_clique proved its result optimal by
+     * reducing the graph to nothing
+     */
+    bool proved_optimal() const { return optimal; }
+
+private:
+    // Moves between clock reads when a time limit is set
+    static constexpr int CLOCK_INTERVAL = 1024;
+
+    int tenure;
+    long long max_iterations;
+    int max_unimproved;
+    double time_limit;
+    int target_size;
+    std::mt19937 rng;
+
+    // Per-run state
+    const Graph* graph = nullptr;
+    CSRGraph csr;
+    BasicCliqueState<CSRGraph> state;
+    std::vector<long long> tabu_until;  // Iteration until which v may not re-enter
+    std::vector<int> best;              // Global vertex IDs
+    bool optimal = false;
+
+    /**
+     * Restrict the CSR graph to the |best|-core of the current one
+     * @return false if no vertex is left
+     */
+    bool reduce();
+
+    /**
+     * Clear the tabu list and restart from a random vertex
+     */
+    void restart();
+
+    /**
+     * Random vertex of set accepted by allow (-1 if none)
+     */
+    template<typename Allow>
+    int pick(const VertexSet& set, Allow allow);
+
+    /**
+     * Record the current clique if it beats the incumbent
+     * @return true if it did
+     */
+    bool record_best();
+};
+
+#endif // TABU_SEARCH_HPP
+
+
+void CSRGraph::build(const Graph& g, const std::vector<int>& vertices) {
+    graph = &g;
+    ids = vertices;
+    int k = ids.size();
+
+    std::vector<int> local(g.num_vertices(), -1);
+    for (int i = 0; i < k; i++) {
+        local[ids[i]] = i;
+    }
+
+    offsets.assign(k + 1, 0);
+    adj.clear();
+    for (int i = 0; i < k; i++) {
+        for (int u : g.get_neighbors(ids[i])) {
+            if (local[u] >= 0) {
+                adj.push_back(local[u]);
+            }
+        }
+        std::sort(adj.begin() + offsets[i], adj.end());
+        offsets[i + 1] = adj.size();
+    }
+}
+
+TabuSearch::TabuSearch(int tenure, long long max_iterations, int max_unimproved,
+                       double time_limit, int target_size, unsigned int seed)
+    : tenure(tenure), max_iterations(max_iterations),
+      max_unimproved(std::max(max_unimproved, 1)), time_limit(time_limit),
+      target_size(target_size) {
+    if (seed == 0) {
+        std::random_device rd;
+        rng.seed(rd());
+    } else {
+        rng.seed(seed);
+    }
+}
+
+bool TabuSearch::reduce() {
+    int k = csr.num_vertices();
+    int threshold = best.size();
+
+    // Peel vertices whose degree drops below |best|
+    std::vector<int> degree(k);
+    std::vector<int> queue;
+    std::vector<char> removed(k, 0);
+    for (int v = 0; v < k; v++) {
+        degree[v] = csr.get_degree(v);
+        if (degree[v] < threshold) {
+            removed[v] = 1;
+            queue.push_back(v);
+        }
+    }
+    for (size_t i = 0; i < queue.size(); i++) {
+        for (int u : csr.get_neighbors(queue[i])) {
+            if (!removed[u] && --degree[u] < threshold) {
+                removed[u] = 1;
+                queue.push_back(u);
+            }
+        }
+    }
+
+    if (queue.empty()) {
+        return k > 0;
+    }
+
+    std::vector<int> survivors;
+    for (int v = 0; v < k; v++) {
+        if (!removed[v]) {
+            survivors.push_back(csr.global_id(v));
+        }
+    }
+    csr.build(*graph, survivors);
+    return !survivors.empty();
+}
+
+void TabuSearch::restart() {
+    tabu_until.assign(csr.num_vertices(), 0);
+    std::uniform_int_distribution<int> vertex_dist(0, csr.num_vertices() - 1);
+    state.assign(csr, {vertex_dist(rng)});
+}
+
+template<typename Allow>
+int TabuSearch::pick(const VertexSet& set, Allow allow) {
+    // Reservoir sampling over the allowed vertices
+    int chosen = -1;
+    int seen = 0;
+    for (int v : set.elements()) {
+        if (!allow(v)) continue;
+        seen++;
+        if (std::uniform_int_distribution<int>(0, seen - 1)(rng) == 0) {
+            chosen = v;
+        }
+    }
+    return chosen;
+}
+
+bool TabuSearch::record_best() {
+    if (state.size() <= (int)best.size()) {
+        return false;
+    }
+    best.clear();
+    for (int v : state.clique().elements()) {
+        best.push_back(csr.global_id(v));
+    }
+    return true;
+}
+
+std::vector<int> TabuSearch::find_clique(const Graph& g) {
+    graph = &g;
+    optimal = false;
+    best = GreedyClique::find_clique_multistart(g).clique;
+
+    std::vector<int> all(g.num_vertices());
+    for (int v = 0; v < g.num_vertices(); v++) {
+        all[v] = v;
+    }
+    csr.build(g, all);
+
+    auto start_time = std::chrono::steady_clock::now();
+    auto out_of_time = [&]() {
+        if (time_limit <= 0.0) return false;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+        return elapsed.count() >= time_limit;
+    };
+    auto reached_target = [&]() {
+        return target_size > 0 && (int)best.size() >= target_size;
+    };
+
+    if (reached_target()) {
+        return best;
+    }
+    if (!reduce()) {
+        optimal = true;
+        return best;
+    }
+    restart();
+    size_t reduced_at = best.size();
+
+    long long last_improvement = 0;
+    for (long long iter = 1; iter <= max_iterations; iter++) {
+        if (iter % CLOCK_INTERVAL == 0 && out_of_time()) break;
+
+        auto not_tabu = [&](int v) { return tabu_until[v] <= iter; };
+
+        // ADD: tabu is overridden when the add gives a new best
+        bool aspiration = state.size() + 1 > (int)best.size();
+        int v = pick(state.add_candidates(),
+                     [&](int u) { return aspiration || not_tabu(u); });
+        if (v >= 0) {
+            state.add(v);
+            if (record_best()) {
+                last_improvement = iter;
+                if (reached_target()) break;
+            }
+        } else if ((v = pick(state.swap_candidates(), not_tabu)) >= 0) {
+            // SWAP: same size, the member pushed out becomes tabu
+            int swap_size = state.swap_candidates().size();
+            int out = state.swap_in(v);
+            tabu_until[out] = iter + tenure +
+                std::uniform_int_distribution<int>(0, swap_size)(rng);
+        } else if (state.size() > 0) {
+            // DROP: shrink by one to leave a local optimum
+            std::uniform_int_distribution<int> idx_dist(0, state.size() - 1);
+            int out = state.clique()[idx_dist(rng)];
+            state.remove(out);
+            tabu_until[out] = iter + tenure;
+        }
+
+        if (iter - last_improvement >= max_unimproved) {
+            // Shrink the graph to what can still beat the incumbent
+            if (best.size() > reduced_at) {
+                reduced_at = best.size();
+                if (!reduce()) {
+                    optimal = true;
+                    break;
+                }
+            }
+            restart();
+            last_improvement = iter;
+        }
+    }
+
+    return best;
+}
@@ -14,8 +14,10 @@
  * 
  * Algorithm by Tomita, Tanaka, and Takahashi (2006)
  * 
+ * The search runs on an explicit SearchStack rather than native recursion.
+ * 
  * Time complexity: O(3^(n/3)) worst case, but much faster in practice
- * Space complexity: O(n) for recursion depth
+ * Space complexity: O(n) frames
  * 
  * Typically 10-100x faster than basic Bron-Kerbosch on real graphs
  */
@@ -28,8 +30,51 @@ public:
      */
     std::vector<int> find_maximum_clique(const Graph& g);
     
+    /**
+     * Stop after this many seconds and return the incumbent
+     * @param seconds Wall-clock limit (0 = none)
+     */
+    void set_time_limit(double seconds) { time_limit = seconds; }
+    
+    /**
+     * Whether the last search was stopped by the time limit
+     */
+    bool timed_out() const { return stopped; }
+    
+    /**
+     * Get number of nodes explored by the last search
+     */
+    long long get_nodes_explored() const { return nodes_explored; }
+    
+    /**
+     * Search-tree statistics of the last search (empty unless built with -DSEARCH_STATS)
+     */
+    const SearchStats& get_search_stats() const { return recorder.stats(); }
+    
 private:
+    /**
+     * Search node: R is the path of frame vertices from the root
+     */
+    struct Frame {
+        int vertex = -1;               // Vertex added to R at this node
+        std::unordered_set<int> P;     // Candidate set
+        std::unordered_set<int> X;     // Excluded set
+        std::vector<int> branches;     // P \ N(pivot), ordered by degree
+        size_t next = 0;
+        
+        void exclude(int v) {
+            P.erase(v);
+            X.insert(v);
+        }
+        
+    };
+    
     std::vector<int> max_clique;
+    SearchStack<Frame> stack;
+    double time_limit = 0.0;
+    bool stopped = false;
+    long long nodes_explored = 0;
+    SearchStatsRecorder recorder;
     
     /**
      * Choose pivot vertex that maximizes |P ∩ N(pivot)|
@@ -43,16 +88,16 @@ private:
                     const Graph& g);
     
     /**
-     * Recursive Tomita procedure with pivoting
-     * @param R Current clique
-     * @param P Candidate set
-     * @param X Excluded set
-     * @param g Graph
+     * Bounds, leaf check and pivoting for a freshly pushed frame
+     * @return false if the node is closed and should be popped
      */
-    void tomita_recursive(std::unordered_set<int> R,
-                         std::unordered_set<int> P,
-                         std::unordered_set<int> X,
-                         const Graph& g);
+    bool enter(const Graph& g);
+    
+    /**
+     * One step of Tomita on the top frame: branch on the next candidate
+     * in P \ N(pivot), or pop when none are left
+     */
+    void step(const Graph& g);
     
     /**
      * Compute intersection of set and vertex neighbors
@@ -64,6 +109,12 @@ private:
     std::unordered_set<int> intersect_with_neighbors(
         const std::unordered_set<int>& s, int v, const Graph& g);
     
+    /**
+     * Write s ∩ N(v) into out, reusing its buckets
+     */
+    void intersect_with_neighbors(const std::unordered_set<int>& s, int v,
+                                  const Graph& g, std::unordered_set<int>& out);
+    
     /**
      * Compute chromatic number upper bound using greedy coloring
      * @param P Set of vertices to color
@@ -71,13 +122,6 @@ private:
      * @return Chromatic number (upper bound)
      */
     int compute_coloring_bound(const std::unordered_set<int>& P, const Graph& g);
-    
-    /**
-     * Find initial greedy clique for better lower bound
-     * @param g Graph
-     * @return Greedy clique
-     */
-    std::vector<int> find_greedy_clique(const Graph& g);
 };
 
 
@@ -97,6 +141,18 @@ std::unordered_set<int> TomitaAlgorithm::intersect_with_neighbors(
     return result;
 }
 
+void TomitaAlgorithm::intersect_with_neighbors(const std::unordered_set<int>& s, int v,
+                                               const Graph& g, std::unordered_set<int>& out) {
+    out.clear();
+    const auto& neighbors = g.get_neighbors(v);
+    
+    for (int u : s) {
+        if (neighbors.find(u) != neighbors.end()) {
+            out.insert(u);
+        }
+    }
+}
+
 int TomitaAlgorithm::compute_coloring_bound(const std::unordered_set<int>& P, 
                                             const Graph& g) {
     if (P.empty()) return 0;
@@ -141,64 +197,6 @@ int TomitaAlgorithm::compute_coloring_bound(const std::unordered_set<int>& P,
     return max_color + 1;  // Chromatic number
 }
 
-std::vector<int> TomitaAlgorithm::find_greedy_clique(const Graph& g) {
-    std::vector<int> clique;
-    int n = g.num_vertices();
-    
-    // Start with highest degree vertex
-    int best_v = -1;
-    int best_deg = -1;
-    for (int v = 0; v < n; v++) {
-        int deg = g.get_neighbors(v).size();
-        if (deg > best_deg) {
-            best_deg = deg;
-            best_v = v;
-        }
-    }
-    
-    if (best_v == -1) return clique;
-    
-    clique.push_back(best_v);
-    
-    // Greedily add vertices that are connected to all current clique members
-    std::unordered_set<int> candidates(g.get_neighbors(best_v).begin(), 
-                                       g.get_neighbors(best_v).end());
-    
-    while (!candidates.empty()) {
-        // Pick candidate with highest degree in candidates
-        int next_v = -1;
-        int max_deg = -1;
-        
-        for (int v : candidates) {
-            int deg = 0;
-            const auto& neighbors = g.get_neighbors(v);
-            for (int u : candidates) {
-                if (neighbors.find(u) != neighbors.end()) deg++;
-            }
-            if (deg > max_deg) {
-                max_deg = deg;
-                next_v = v;
-            }
-        }
-        
-        if (next_v == -1) break;
-        
-        clique.push_back(next_v);
-        
-        // Update candidates: intersect with neighbors of next_v
-        std::unordered_set<int> new_candidates;
-        const auto& neighbors = g.get_neighbors(next_v);
-        for (int v : candidates) {
-            if (v != next_v && neighbors.find(v) != neighbors.end()) {
-                new_candidates.insert(v);
-            }
-        }
-        candidates = new_candidates;
-    }
-    
-    return clique;
-}
-
 int TomitaAlgorithm::choose_pivot(const std::unordered_set<int>& P,
                                   const std::unordered_set<int>& X,
                                   const Graph& g) {
@@ -227,48 +225,61 @@ int TomitaAlgorithm::choose_pivot(const std::unordered_set<int>& P,
     return best_pivot;
 }
 
-void TomitaAlgorithm::tomita_recursive(std::unordered_set<int> R,
-                                       std::unordered_set<int> P,
-                                       std::unordered_set<int> X,
-                                       const Graph& g) {
+bool TomitaAlgorithm::enter(const Graph& g) {
+    nodes_explored++;
+    
+    Frame& f = stack.back();
+    size_t r = stack.depth() - 1;  // |R|
+    const auto& P = f.P;
+    recorder.node(r);
+    if (P.empty()) {
+        recorder.leaf();
+    }
+    
     // OPTIMIZATION 1: Color-based upper bound pruning (tighter than |R| + |P|)
     int coloring_bound = compute_coloring_bound(P, g);
-    if (R.size() + coloring_bound <= max_clique.size()) {
-        return;  // Chromatic number provides tight upper bound
+    if (r + coloring_bound <= max_clique.size()) {
+        if (!P.empty()) recorder.coloring_prune();
+        return false;  // Chromatic number provides tight upper bound
     }
     
     // OPTIMIZATION 2: Simple upper bound (fallback)
-    if (R.size() + P.size() <= max_clique.size()) {
-        return;  // Cannot find a larger clique in this branch
+    if (r + P.size() <= max_clique.size()) {
+        if (!P.empty()) recorder.size_prune();
+        return false;  // Cannot find a larger clique in this branch
     }
     
     // Base case: if P and X are both empty, R is a maximal clique
-    if (P.empty() && X.empty()) {
-        if (R.size() > max_clique.size()) {
-            max_clique.assign(R.begin(), R.end());
+    if (P.empty() && f.X.empty()) {
+        if (r > max_clique.size()) {
+            max_clique.clear();
+            for (size_t d = 1; d < stack.depth(); d++) {
+                max_clique.push_back(stack[d].vertex);
+            }
+            recorder.incumbent(r);
         }
-        return;
+        return false;
     }
     
     // Choose pivot
-    int pivot = choose_pivot(P, X, g);
+    int pivot = choose_pivot(P, f.X, g);
     
-    // Compute P \ N(pivot) - vertices to recurse on
-    std::unordered_set<int> candidates;
+    // Compute P \ N(pivot) - vertices to branch on
+    f.branches.clear();
+    f.next = 0;
     if (pivot != -1) {
         const auto& pivot_neighbors = g.get_neighbors(pivot);
         for (int v : P) {
             if (pivot_neighbors.find(v) == pivot_neighbors.end()) {
-                candidates.insert(v);
+                f.branches.push_back(v);
             }
         }
     } else {
-        candidates = P;
+        f.branches.assign(P.begin(), P.end());
     }
     
     // OPTIMIZATION 3: Order candidates by degree (descending) for better pruning
-    std::vector<int> candidates_ordered(candidates.begin(), candidates.end());
-    std::sort(candidates_ordered.begin(), candidates_ordered.end(),
+    std::sort(f.branches.begin(), f.branches.end(),
               [&g, &P](int u, int v) {
                   const auto& nu = g.get_neighbors(u);
                   const auto& nv = g.get_neighbors(v);
@@ -280,45 +291,70 @@ void TomitaAlgorithm::tomita_recursive(std::unordered_set<int> R,
                   return deg_u > deg_v;
               });
     
-    // For each vertex in candidates (ordered)
-    for (int v : candidates_ordered) {
-        // OPTIMIZATION 4: Early termination check
-        if (R.size() + 1 + P.size() <= max_clique.size()) {
-            break;  // No point continuing
-        }
-        
-        // Create new sets
-        std::unordered_set<int> R_new = R;
-        R_new.insert(v);
-        
-        std::unordered_set<int> P_new = intersect_with_neighbors(P, v, g);
-        std::unordered_set<int> X_new = intersect_with_neighbors(X, v, g);
-        
-        // Recurse
-        tomita_recursive(R_new, P_new, X_new, g);
-        
-        // Move v from P to X
-        P.erase(v);
-        X.insert(v);
+    return true;
+}
+
+void TomitaAlgorithm::step(const Graph& g) {
+    size_t d = stack.depth() - 1;
+    Frame& f = stack[d];
+    
+    // OPTIMIZATION 4: Early termination check
+    if (f.next == f.branches.size()) {
+        stack.pop();
+        return;
+    }
+    if (d + 1 + f.P.size() <= max_clique.size()) {
+        recorder.size_prune();
+        stack.pop();
+        return;
+    }
+    
+    int v = f.branches[f.next++];
+    
+    // Child: R∪{v}, P∩N(v), X∩N(v)
+    Frame& child = stack.push();
+    Frame& parent = stack[d];
+    child.vertex = v;
+    intersect_with_neighbors(parent.P, v, g, child.P);
+    intersect_with_neighbors(parent.X, v, g, child.X);
+    
+    // Move v from P to X
+    parent.exclude(v);
+    
+    if (!enter(g)) {
+        stack.pop();
     }
 }
 
 std::vector<int> TomitaAlgorithm::find_maximum_clique(const Graph& g) {
-    // OPTIMIZATION: Seed with greedy clique for better initial lower bound
-    max_clique = find_greedy_clique(g);
-    
-    // Initialize sets
-    std::unordered_set<int> R;  // Current clique (empty initially)
-    std::unordered_set<int> P;  // Candidate vertices (all vertices initially)
-    std::unordered_set<int> X;  // Excluded vertices (empty initially)
+    SearchDeadline deadline;
+    deadline.start(time_limit);
+    stopped = false;
+    nodes_explored = 0;
+    recorder.start();
+    
+    // OPTIMIZATION: Seed with multi-start greedy clique for better initial lower bound
+    max_clique = GreedyClique::find_clique_multistart(g).clique;
+    recorder.incumbent(max_clique.size());
+    
+    // Root: R empty, P = all vertices, X empty
+    stack.clear();
+    Frame& root = stack.push();
+    root.vertex = -1;
+    root.P.clear();
+    root.X.clear();
     
     int n = g.num_vertices();
     for (int v = 0; v < n; v++) {
-        P.insert(v);
+        root.P.insert(v);
     }
     
     // Run algorithm
-    tomita_recursive(R, P, X, g);
+    if (enter(g)) {
+        stopped = !stack.run_until([&](SearchStack<Frame>&) { step(g); }, deadline);
+    } else {
+        stack.clear();
+    }
     
     return max_clique;
 }